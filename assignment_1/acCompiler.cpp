@@ -17,7 +17,7 @@
 
 /*---*
  *---*    Compile with:
- *---*    $ g++ acCompiler.cpp -o acCompiler
+ *---*    $ g++ -std=c++11 -pthread acCompiler.cpp -o acCompiler
  *---*/
 
 /*---*
@@ -28,12 +28,35 @@
 #include    <cstdio>
 #include    <cstring>
 #include    <cctype>
-
+#include    <csignal>
+
+#include    <dirent.h>
+#include    <fcntl.h>
+#include    <sys/mman.h>
+#include    <sys/resource.h>
+#include    <sys/stat.h>
+#include    <sys/time.h>
+#include    <sys/wait.h>
+#include    <unistd.h>
+
+#if defined(__x86_64__)
+#include    <immintrin.h>
+#endif
+
+#include    <algorithm>
+#include    <atomic>
+#include    <deque>
+#include    <fstream>
 #include    <iostream>
+#include    <iterator>
+#include    <mutex>
+#include    <sstream>
 #include    <string>
+#include    <thread>
+#include    <vector>
 
 
-char errorMessage[256];
+thread_local char errorMessage[256];
 
 /*---*
  *---*    Ordinal enumerations:
@@ -60,60 +83,112 @@ typedef enum    {
         FLOAT_DECLARE_SYMBOL,
         PRINT_SYMBOL,
         ASSIGN_SYMBOL,
-        STATEMENT_LIST_SYMBOL,
         TYPE_CONVERT_SYMBOL
       }
       symbol_t;
 
 
+//  PURPOSE:  To identify the classes of chars skipped in runs by the
+//  scanner.
+typedef enum    {
+        SPACE_CHAR_CLASS,
+        DIGIT_CHAR_CLASS
+      }
+      charClass_t;
+
+
+//  PURPOSE:  To identify the ways runs of chars may be skipped: one char
+//  at a time, or 16 or 32 at a time with SSE2 or AVX2 instructions.
+typedef enum    {
+        SCALAR_SCAN_MODE,
+        SSE2_SCAN_MODE,
+        AVX2_SCAN_MODE
+      }
+      scanMode_t;
+
+
+//  PURPOSE:  To identify 'dc' instructions.
+typedef enum    {
+        NO_DC_OP,
+        PUSH_NUMBER_DC_OP,
+        LOAD_DC_OP,
+        STORE_DC_OP,
+        DUPLICATE_DC_OP,
+        ADD_DC_OP,
+        SUBTRACT_DC_OP,
+        PRINT_DC_OP,
+        DISCARD_DC_OP,
+        PRECISION_DC_OP
+      }
+      dcOp_t;
+
+
 
 /*---*
  *---*    Data-structures that hold per-node parsed information:
  *---*/
 
-struct  Symbol;
-
-//  PURPOSE:  To hold the knowledge needed for an Expression (+/-).
-struct  Expression
+//  PURPOSE:  To locate the exact text of a numeric literal within the buffer
+//  that holds it.
+struct  Literal
 {
-  Symbol*   lhsPtr_;
-  Symbol*   rhsPtr_;
+  size_t    offset_;
+  size_t    length_;
 };
 
 
-//  PURPOSE:  To hold the knowledge needed for an assignment.
-struct  Assignment
+//  PURPOSE:  To hold one scanned lexeme.
+struct  Symbol
 {
-  Symbol*   varPtr_;
-  Symbol*   lhsPtr_;
-  Symbol*   rhsPtr_;
+  symbol_t    symbol_;
+
+  union
+  {
+    Literal   literal_;
+    int     varId_;
+  }       value_;
 };
 
 
-//  PURPOSE:  To hold the knowledge needed for a sequence of statements.
-struct  Statement
-{
-  Symbol*   firstPtr_;
-  Symbol*   restPtr_;
-};
+//  PURPOSE:  To identify a node of a 'SyntaxTree' by its index.
+typedef unsigned int
+      NodeInd;
 
 
-//  PURPOSE:  To hold the knowledge that could be at any node.
-struct  Symbol
+//  PURPOSE:  To stand for no node.
+const NodeInd NO_NODE = 0;
+
+
+//  PURPOSE:  To hold one 'dc' instruction.
+struct  DcInstruction
 {
-  symbol_t    symbol_;
+  dcOp_t    op_;
   union
   {
     int     integer_;
-    float   floatPt_;
-    char    varName_;
-    Expression    expression_;
-    Assignment    assignment_;
-    Statement   statement_;
+    Literal   literal_;
+    int     varId_;
   }       value_;
 };
 
 
+//  PURPOSE:  To hold the statements of a parsed program, in program order.
+typedef std::vector<NodeInd>
+      StatementList;
+
+
+//  PURPOSE:  To count what was done while translating a program, for
+//  "--stats".
+struct  TranslationStats
+{
+  size_t    numValuesPropagated_;
+  size_t    numNodesFolded_;
+  size_t    numStatementsRemoved_;
+  size_t    numInstructionsBefore_;
+  size_t    numInstructionsAfter_;
+};
+
+
 //  PURPOSE:  To represent a special 'Symbol' that means the end of the input
 //  stream.
 Symbol      endSymbol;
@@ -123,817 +198,6317 @@ Symbol      endSymbol;
  *---*    Helper classes:
  *---*/
 
-/*  PURPOSE:  To implement an interface that manages the character source.
+/*  PURPOSE:  To hold the syntax tree of one program (or one batch of its
+ *  statements) as a structure of arrays.  A node is an index into parallel
+ *  arrays of its 'symbol_t', its type and up to three 32-bit fields, laid
+ *  down in parse order, so a node takes 'BYTES_PER_NODE' bytes instead of a
+ *  whole 'Symbol' and walking the nodes of a batch is a linear scan.  The
+ *  fields of a node hold:
+ *
+ *    INT_SYMBOL, FLOAT_SYMBOL:   the offset and length of its literal,
+ *    ID_SYMBOL:        its variable id,
+ *    ADD_SYMBOL, SUBTRACT_SYMBOL:  its value ("lhs") and the rest of its
+ *            chain ("rhs"),
+ *    PRINT_SYMBOL, TYPE_CONVERT_SYMBOL:  its operand ("lhs"),
+ *    ASSIGN_SYMBOL:      its variable node, its first value and the
+ *            rest of its chain.
+ *
+ *  Node 0 is never handed out: 'NO_NODE' stands for no node.
  */
-class InputCharStream
+class SyntaxTree
 {
-  //  I.  Member vars:
-  //  PURPOSE:  To hold the input.
-  std::string   input_;
+public :
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To tell how many bytes each node takes.
+  static
+  const
+  size_t    BYTES_PER_NODE  = 2 + 3 * sizeof(NodeInd);
 
-  //  PURPOSE:  To hold where the cursor is.
-  int     index_;
+private :
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the 'symbol_t' and the 'dcType_t' of each node.
+  std::vector<unsigned char>
+      symbolVect_;
+  std::vector<unsigned char>
+      typeVect_;
+
+  //  PURPOSE:  To hold the fields of each node.
+  std::vector<NodeInd>
+      firstVect_;
+  std::vector<NodeInd>
+      secondVect_;
+  std::vector<NodeInd>
+      thirdVect_;
+
+  //  PURPOSE:  To count the nodes handed out.
+  size_t    numNodes_;
+
+  //  PURPOSE:  To hold the most bytes of node storage ever held at once.
+  size_t    peakNumBytes_;
 
   //  II.  Disallowed auto-generated methods:
-  
+  //  No copy constructor:
+  SyntaxTree    (const SyntaxTree&
+        );
+
+  //  No copy assignment op:
+  SyntaxTree&   operator=
+      (const SyntaxTree&
+        );
+
   //  III.  Protected methods:
 protected :
+  //  PURPOSE:  To return the number of bytes of node storage held now.  No
+  //  parameters.
+  size_t    getNumBytes ()
+        const
+      throw()
+      { return(symbolVect_.capacity() * BYTES_PER_NODE); }
 
 public:
   //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
-  //  PURPOSE:  To
-  InputCharStream (std::string& newInput
-        ) :
-      input_(newInput),
-      index_(0)
+  //  PURPOSE:  To initialize '*this' to hold no nodes.  No parameters.
+  SyntaxTree    ()
+      throw() :
+      numNodes_(0),
+      peakNumBytes_(0)
+      { rewind(); }
+
+  //  PURPOSE:  To release resources.  No parameters.
+  ~SyntaxTree   ()
+      throw()
       { }
 
   //  V.  Accessors:
+  //  PURPOSE:  To return the number of nodes handed out.
+  size_t    getNumNodes ()
+        const
+      throw()
+      { return(numNodes_); }
 
-  //  VI.  Mutators:
-
-  //  VII.  Methods that do main and misc work of class:
-  //  PURPOSE:  To return the current char, or '\0' if there are no more.
-  //  No parameters.
-  char    peek  ()
+  //  PURPOSE:  To return the most bytes of node storage ever held at once.
+  size_t    getPeakNumBytes ()
         const
       throw()
-      { return
-        ( (index_ >= input_.length())
-          ? '\0' : input_[index_]
+      {
+        return( (peakNumBytes_ > getNumBytes())
+          ? peakNumBytes_
+          : getNumBytes()
         );
       }
 
-  //  PURPOSE:  To return 'true' if at eof-of-input, or 'false' otherwise.
-  bool    isAtEnd ()
+  //  PURPOSE:  To return one more than the index of the last node handed
+  //  out since the last 'rewind()'.
+  NodeInd   getEndInd ()
         const
       throw()
-      { return(index_ >= input_.length()); }
+      { return((NodeInd)symbolVect_.size()); }
 
-  //  PURPOSE:  To advance to the next char (if not already at end).  No
-  //  parameters.  No return value.
-  void    advance ()
-        throw()
+  //  PURPOSE:  To return the 'symbol_t' of node 'node'.
+  symbol_t    getSymbol (NodeInd  node
+        )
+        const
+      throw()
+      { return((symbol_t)symbolVect_[node]); }
+
+  //  PURPOSE:  To return the type of node 'node' as resolved by
+  //  'annotateTypes()', or 'NULL_DC_TYPE' for 'NO_NODE'.
+  dcType_t    getType (NodeInd  node
+        )
+        const
+      throw()
+      { return((dcType_t)typeVect_[node]); }
+
+  //  PURPOSE:  To return the literal of the number node 'node'.
+  Literal   getLiteral  (NodeInd  node
+        )
+        const
+      throw()
       {
-        if  (index_ < input_.length())  index_++;
+        Literal literal;
+
+        literal.offset_ = firstVect_[node];
+        literal.length_ = secondVect_[node];
+        return(literal);
       }
 
-};
+  //  PURPOSE:  To return the length of the literal of number node 'node'.
+  size_t    getLiteralLength
+      (NodeInd  node
+      )
+        const
+      throw()
+      { return(secondVect_[node]); }
 
+  //  PURPOSE:  To return the variable id of the variable node 'node'.
+  int     getVarId  (NodeInd  node
+        )
+        const
+      throw()
+      { return((int)firstVect_[node]); }
 
+  //  PURPOSE:  To return the value ("lhs") of the '+', '-', print or
+  //  conversion node 'node'.
+  NodeInd   getLhs    (NodeInd  node
+        )
+        const
+      throw()
+      { return(firstVect_[node]); }
 
-//  PURPOSE:  To implement an interface that gathers characters into lexemes.
-class TokenStream
-{
-  //  I.  Member vars:
-  //  PURPOSE:  To hold the source of the character input.
-  InputCharStream&  inputCharStream_;
+  //  PURPOSE:  To return the rest of the chain ("rhs") of the '+' or '-'
+  //  node 'node'.
+  NodeInd   getRhs    (NodeInd  node
+        )
+        const
+      throw()
+      { return(secondVect_[node]); }
 
-  //  PURPOSE:  To hold the lastest lexeme parsed.
-  Symbol*     lastParsedPtr_;
+  //  PURPOSE:  To return the variable node of the assignment node 'node'.
+  NodeInd   getAssignedVar  (NodeInd  node
+        )
+        const
+      throw()
+      { return(firstVect_[node]); }
 
-  //  II.  Disallowed auto-generated methods:
-  //  No default constructor:
-  TokenStream   ();
+  //  PURPOSE:  To return the first value of the assignment node 'node'.
+  NodeInd   getAssignedLhs  (NodeInd  node
+        )
+        const
+      throw()
+      { return(secondVect_[node]); }
 
-  //  No copy constructor:
-  TokenStream   (const TokenStream&
-      );
+  //  PURPOSE:  To return the rest of the chain of the assignment node 'node'.
+  NodeInd   getAssignedRhs  (NodeInd  node
+        )
+        const
+      throw()
+      { return(thirdVect_[node]); }
 
-  //  No copy assignment op:
-  TokenStream&    operator=
-      (const TokenStream&
-      );
+  //  VI.  Mutators:
+  //  PURPOSE:  To set the type of node 'node' to 'type'.  No return value.
+  void    setType (NodeInd  node,
+         dcType_t type
+        )
+      throw()
+      { typeVect_[node] = (unsigned char)type; }
 
-protected :
-  //  III.  Protected methods:
-  //  PURPOSE:  To return a pointer representing a scanned number, either
-  //  an integer or floating point.  No parameters.
-  Symbol*     scanDigits
-      ()
+  //  PURPOSE:  To set the value ("lhs") of the '+', '-', print or conversion
+  //  node 'node' to 'lhs'.  No return value.
+  void    setLhs    (NodeInd  node,
+         NodeInd  lhs
+        )
       throw()
-      {
-        std::string lex("");
+      { firstVect_[node]  = lhs; }
 
-        while  ( isdigit(inputCharStream_.peek()) )
-        {
-          lex += inputCharStream_.peek();
-          inputCharStream_.advance();
-        }
+  //  PURPOSE:  To set the rest of the chain of '+' or '-' node 'node' to
+  //  'rhs'.  No return value.
+  void    setRhs    (NodeInd  node,
+         NodeInd  rhs
+        )
+      throw()
+      { secondVect_[node] = rhs; }
 
-        Symbol* symbolPtr;
+  //  PURPOSE:  To set the variable node of assignment node 'node' to 'var'.
+  //  No return value.
+  void    setAssignedVar  (NodeInd  node,
+         NodeInd  var
+        )
+      throw()
+      { firstVect_[node]  = var; }
 
-        if  (inputCharStream_.peek() != '.')
-        {
-          symbolPtr   = (Symbol*)
-                  malloc(sizeof(Symbol));
-          symbolPtr->symbol_  = INT_SYMBOL;
-          symbolPtr->value_.integer_
-            = strtol(lex.c_str(),NULL,10);
-        }
-        else
-        {
-          lex += inputCharStream_.peek();
-          inputCharStream_.advance();
-          while  ( isdigit(inputCharStream_.peek()) )
-          {
-            lex += inputCharStream_.peek();
-            inputCharStream_.advance();
-          }
+  //  PURPOSE:  To set the first value of assignment node 'node' to 'lhs'.
+  //  No return value.
+  void    setAssignedLhs  (NodeInd  node,
+         NodeInd  lhs
+        )
+      throw()
+      { secondVect_[node] = lhs; }
 
-          symbolPtr   = (Symbol*)
-                  malloc(sizeof(Symbol));
-          symbolPtr->symbol_  = FLOAT_SYMBOL;
-          symbolPtr->value_.floatPt_
-            = strtod(lex.c_str(),NULL);
-        }
+  //  PURPOSE:  To set the rest of the chain of assignment node 'node' to
+  //  'rhs'.  No return value.
+  void    setAssignedRhs  (NodeInd  node,
+         NodeInd  rhs
+        )
+      throw()
+      { thirdVect_[node]  = rhs; }
 
-        return(symbolPtr);
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To return a new node of 'symbol_t' 'symbol' and type 'type'
+  //  whose fields are 'first', 'second' and 'third'.
+  NodeInd   newNode   (symbol_t symbol,
+         dcType_t type,
+         NodeInd  first  = NO_NODE,
+         NodeInd  second = NO_NODE,
+         NodeInd  third  = NO_NODE
+        )
+      throw(const char*)
+      {
+        NodeInd node  = getEndInd();
+
+        if  (node == (NodeInd)-1)
+          throw "Program too big";
+
+        symbolVect_.push_back((unsigned char)symbol);
+        typeVect_.push_back((unsigned char)type);
+        firstVect_.push_back(first);
+        secondVect_.push_back(second);
+        thirdVect_.push_back(third);
+        numNodes_++;
+        return(node);
       }
 
-
-  //  PURPOSE:  To return a pointer representing a scanned Symbol, or to return
-  //  '&endSymbol' if the '*this' is at the end-of-input.  No parameters.
-  Symbol* scanner ()
+  //  PURPOSE:  To return a new node, not yet typed, for the scanned 'token'.
+  NodeInd   newNode   (const Symbol&  token
+      )
       throw(const char*)
+      {
+        switch  (token.symbol_)
         {
-        while  ( isspace(inputCharStream_.peek()) )
-          inputCharStream_.advance();
-
-        if  ( inputCharStream_.isAtEnd() )
-          return( &endSymbol );
-
-        if  ( isdigit(inputCharStream_.peek()) )
-          return( scanDigits() );
-
-        char      ch    = inputCharStream_.peek();
-        
-        Symbol*   symbolPtr = (Symbol*)
-                    malloc(sizeof(Symbol));
-
-        inputCharStream_.advance();
-
-        switch  (ch)
-        {
-        case '=' :
-          symbolPtr->symbol_  = ASSIGN_SYMBOL;
-          break;
-
-        case '+' :
-          symbolPtr->symbol_  = ADD_SYMBOL;
-          break;
-
-        case '-' :
-          symbolPtr->symbol_  = SUBTRACT_SYMBOL;
-          break;
+        case INT_SYMBOL :
+        case FLOAT_SYMBOL :
+          return(newLiteral(token.symbol_,NULL_DC_TYPE,token.value_.literal_));
 
-        case 'p' :
-          symbolPtr->symbol_  = PRINT_SYMBOL;
-          break;
-
-        case 'i' :
-          // inputCharStream_.advance();
-          // char ch1 = inputCharStream_.peek();
-          // if(ch1=='n') printf("hahahhaha\n"); 
-          symbolPtr->symbol_  = INT_DECLARE_SYMBOL;
-          break;
-
-        case 'f' :
-          symbolPtr->symbol_  = FLOAT_DECLARE_SYMBOL;
-          break;
+        case ID_SYMBOL :
+          return(newNode(ID_SYMBOL,NULL_DC_TYPE,(NodeInd)token.value_.varId_));
 
         default :
-          if  ( islower(ch) )
-          {
-            symbolPtr->symbol_  = ID_SYMBOL;
-            symbolPtr->value_.varName_= ch;
-            break;
-          }
-
-          throw "Unexpected character in input";
+          return(newNode(token.symbol_,NULL_DC_TYPE));
         }
-
-        return(symbolPtr);
       }
 
-public :
-  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
-  //  PURPOSE:  To initialize '*this'
-  TokenStream   (InputCharStream& newInputCharStream
+  //  PURPOSE:  To return a new number node of 'symbol_t' 'symbol' and type
+  //  'type' for 'literal'.
+  NodeInd   newLiteral  (symbol_t symbol,
+         dcType_t type,
+         const Literal& literal
         )
-      throw(const char*) :
-      inputCharStream_(newInputCharStream),
-      lastParsedPtr_(NULL)
+      throw(const char*)
       {
-        advance();
-      }
-
-  //  V.  Accessors:
+        if  ( (literal.offset_ + literal.length_) > (NodeInd)-1 )
+          throw "Literal too long";
 
-  //  VI.  Mutators:
+        return(newNode(symbol,type,(NodeInd)literal.offset_,
+           (NodeInd)literal.length_
+          )
+        );
+      }
 
-  //  VII.  Methods that do main and misc work of class:
-  //  PURPOSE:  To return the 'symbol_t' of the 'Symbol' instance that is next
-  //  in the symbol stream.  No parameters.
-  symbol_t    peek  ()
-        throw(const char*)
+  //  PURPOSE:  To return a new node that starts out as a copy of node
+  //  'node'.
+  NodeInd   copyNode  (NodeInd  node
+        )
+      throw(const char*)
       {
-        if  (lastParsedPtr_ == NULL)
-          lastParsedPtr_  = scanner();
-
-        return(lastParsedPtr_->symbol_);
+        return(newNode(getSymbol(node),getType(node),firstVect_[node],
+           secondVect_[node],thirdVect_[node]
+          )
+        );
       }
 
-  //  PURPOSE:  To return the pointer to the old Symbol at that was at the
-  //  front of the symbol stream, and then to internally advance to the next
-  //  Symbol instance (if not already at the end).  No parameters.
-  Symbol* advance ()
-        throw(const char*)
+  //  PURPOSE:  To take back every node handed out by '*this' at once,
+  //  keeping the storage to hand out again.  No parameters.  No return
+  //  value.
+  void    rewind  ()
+      throw()
       {
-        Symbol* toReturn  = lastParsedPtr_;
+        if  (peakNumBytes_ < getNumBytes())
+          peakNumBytes_ = getNumBytes();
+
+        symbolVect_.assign(1,(unsigned char)END_OF_FILE_SYMBOL);
+        typeVect_.assign(1,(unsigned char)NULL_DC_TYPE);
+        firstVect_.assign(1,NO_NODE);
+        secondVect_.assign(1,NO_NODE);
+        thirdVect_.assign(1,NO_NODE);
+      }
 
-        lastParsedPtr_  = scanner();
-        return(toReturn);
+  //  PURPOSE:  To take back every node handed out by '*this' at once, and
+  //  to free the storage.  No parameters.  No return value.
+  void    release ()
+      throw()
+      {
+        std::vector<unsigned char>().swap(symbolVect_);
+        std::vector<unsigned char>().swap(typeVect_);
+        std::vector<NodeInd>().swap(firstVect_);
+        std::vector<NodeInd>().swap(secondVect_);
+        std::vector<NodeInd>().swap(thirdVect_);
+        rewind();
       }
 
 };
 
 
-//  PURPOSE:  To implement a class that holds the types of the symbols (well,
-//  variables) that occur in the parsed program.
-class SymbolTable
-{
-  //  0.  Internal constants and types:
-  static
-  const
-  int     MAX_NUM_VARS  = 26*2;
 
+/*  PURPOSE:  To map a file read-only into memory for as long as '*this'
+ *  lives, so that it may be scanned in place rather than read and copied.
+ *  The kernel is told that the mapping will be read in order, so it reads
+ *  ahead and may drop the pages already passed, and a file larger than RAM
+ *  may be mapped.
+ */
+class MappedFile
+{
   //  I.  Member vars:
-  //  PURPOSE:  To hold the types for all possible vars.
-  dcType_t    typeArray_[MAX_NUM_VARS];
+  //  PURPOSE:  To point to the first char of the mapping, or to be 'NULL'
+  //  if the file is empty.
+  char*     textPtr_;
+
+  //  PURPOSE:  To hold the number of chars mapped.
+  size_t    length_;
 
   //  II.  Disallowed auto-generated methods:
+  //  No default constructor:
+  MappedFile    ();
+
   //  No copy constructor:
-  SymbolTable   (const SymbolTable&
+  MappedFile    (const MappedFile&
         );
 
   //  No copy assignment op:
-  SymbolTable&    operator=
-      (const SymbolTable&
+  MappedFile&   operator=
+      (const MappedFile&
         );
 
   //  III.  Protected methods:
 protected :
-  //  PURPOSE:  To return the index in 'typeArray_[]' for variable with name
-  //  'varName'.
-  static
-  int   getIndex(char varName
-        )
-      {
-        return( isupper(varName)
-            ? (varName - 'A')
-          : ((varName - 'a') + 26)
-          );
-      }
 
 public:
   //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
-  //  PURPOSE:  To initialize '*this' table to hold no symbols.  No parameters.
-  //  No return value.
-  SymbolTable   ()
-      throw()
-        {
-        for  (int i = 0;  i < MAX_NUM_VARS;  i++)
-          typeArray_[i] = NULL_DC_TYPE;
-      }
-
-  ~SymbolTable    ()
-      { }
-
-  //  V.  Accessors:
-
-  //  VI.  Mutators:
-
-  //  VII.  Methods that do main and misc work of class:
-  //  PURPOSE:  To store the type of the variable named 'varName' as being
-  //  'varType', assuming there is no type already recorded.  No return
-  //  value.
-  void    enter (dcType_t varType,
-         char   varName
+  //  PURPOSE:  To initialize '*this' to map the file at path 'pathPtr',
+  //  which must be a regular file.
+  MappedFile    (const char*  pathPtr
         )
-      throw(const char*)
+      throw(const char*) :
+      textPtr_(NULL),
+      length_(0)
       {
-        int index = getIndex(varName);
+        int   fd  = open(pathPtr,O_RDONLY);
+        struct stat status;
+
+        if  ( (fd < 0)  ||  (fstat(fd,&status) != 0) )
+        {
+          if  (fd >= 0)
+            close(fd);
 
-        if  (typeArray_[index] != NULL_DC_TYPE) {
-          snprintf(errorMessage,256,"Attempt to redefine symbol %c", varName);
+          snprintf(errorMessage,256,"Cannot open %s",pathPtr);
           throw errorMessage;
-          //throw "Attempt to redefine symbol";
+        }
+
+        length_ = (size_t)status.st_size;
+
+        if  (length_ > 0)
+        {
+          void* mapPtr  = mmap(NULL,length_,PROT_READ,MAP_PRIVATE,fd,0);
+
+          if  (mapPtr == MAP_FAILED)
+          {
+            close(fd);
+            snprintf(errorMessage,256,"Cannot map %s",pathPtr);
+            throw errorMessage;
+          }
+
+          textPtr_  = (char*)mapPtr;
+          madvise(textPtr_,length_,MADV_SEQUENTIAL);
+        }
+
+        //  The mapping outlives the descriptor:
+        close(fd);
+      }
+
+  //  PURPOSE:  To release resources.  No parameters.
+  ~MappedFile   ()
+      throw()
+      {
+        if  (textPtr_ != NULL)
+          munmap(textPtr_,length_);
+      }
+
+  //  PURPOSE:  To return 'true' if the file at path 'pathPtr' is a regular
+  //  file, and so may be mapped, or 'false' otherwise (e.g. if it is a pipe
+  //  or it does not exist).
+  static
+  bool    canMap  (const char*  pathPtr
+        )
+      throw()
+      {
+        struct stat status;
+
+        return( (stat(pathPtr,&status) == 0)  &&  S_ISREG(status.st_mode) );
+      }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return the address of the first char of the file.
+  const char* getText ()
+        const
+      throw()
+      { return(textPtr_); }
+
+  //  PURPOSE:  To return the number of chars in the file.
+  size_t    getLength ()
+        const
+      throw()
+      { return(length_); }
+
+};
+
+
+
+/*  PURPOSE:  To implement an interface that manages the character source.
+ *  Characters come either from text held by the caller (e.g. a string or a
+ *  'MappedFile'), which is then only viewed, so its lexemes may be handed
+ *  out as slices of it, or from a 'FILE*' read one fixed-size chunk at a
+ *  time.  Either way a file of any length is translated in constant memory.
+ */
+class InputCharStream
+{
+  //  0.  Internal constants and types:
+  static
+  const
+  int     CHUNK_SIZE  = 64 * 1024;
+
+  //  PURPOSE:  To tell how many chars of a mapped file must be passed before
+  //  their pages are given back.
+  static
+  const
+  size_t    RELEASE_SIZE  = 4 * 1024 * 1024;
+
+  //  PURPOSE:  To tell how many chars of a run are tested one at a time
+  //  before testing them a vector at a time.
+  static
+  const
+  int     SHORT_RUN_LEN = 8;
+
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the file to read from, or 'NULL' if the whole input
+  //  was given as a string.
+  FILE*     filePtr_;
+
+  //  PURPOSE:  To point to the current char, and just past the last char
+  //  available without reading more.
+  const char*   cursorPtr_;
+  const char*   endPtr_;
+
+  //  PURPOSE:  To point to the first char of a mapped file whose page has
+  //  not been given back, or to be 'NULL' if the text is not a mapping.
+  const char*   releasedPtr_;
+
+  //  PURPOSE:  To tell how runs of chars are skipped.
+  scanMode_t    scanMode_;
+
+  //  PURPOSE:  To hold the most recently read chunk of 'filePtr_'.
+  char      buffer_[CHUNK_SIZE];
+
+  //  II.  Disallowed auto-generated methods:
+  //  No copy constructor:
+  InputCharStream (const InputCharStream&
+        );
+
+  //  No copy assignment op:
+  InputCharStream&  operator=
+      (const InputCharStream&
+        );
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To read the next chunk of 'filePtr_' into 'buffer_'.  Returns
+  //  'true' if at least one more char is available, or 'false' otherwise.
+  //  Throws if reading fails, so that no program is translated truncated.
+  //  No parameters.
+  bool    refill  ()
+      throw(const char*)
+      {
+        if  (filePtr_ == NULL)
+          return(false);
+
+        size_t  numRead = fread(buffer_,1,CHUNK_SIZE,filePtr_);
+
+        if  ( (numRead < (size_t)CHUNK_SIZE)  &&  ferror(filePtr_) )
+          throw "Cannot read input";
+
+        cursorPtr_  = buffer_;
+        endPtr_   = buffer_ + numRead;
+        return(numRead > 0);
+      }
+
+  //  PURPOSE:  To return 'true' if 'ch' is of class 'charClass', or 'false'
+  //  otherwise.
+  static
+  bool    isOfClass (char   ch,
+         charClass_t  charClass
+        )
+      throw()
+      {
+        return( (charClass == SPACE_CHAR_CLASS)
+          ? (isspace(ch) != 0)
+          : (isdigit(ch) != 0)
+        );
+      }
+
+  //  PURPOSE:  To return the address of the first char from 'runPtr' up to
+  //  'endPtr' that is not of class 'charClass' (or 'endPtr' if there is
+  //  none), testing one char at a time.
+  static
+  const char* findRunEndScalar
+      (const char*  runPtr,
+       const char*  endPtr,
+       charClass_t  charClass
+      )
+      throw()
+      {
+        while  ( (runPtr < endPtr)  &&  isOfClass(*runPtr,charClass) )
+          runPtr++;
+
+        return(runPtr);
+      }
+
+#if defined(__x86_64__)
+  //  PURPOSE:  To do as 'findRunEndScalar()', but testing 16 chars at a time
+  //  with SSE2 instructions (which every x86-64 has).  A char is of the
+  //  class if it is between the bounds of the class or equal to its extra
+  //  char: '\t' to '\r' or ' ' for whitespace, and '0' to '9' for digits.
+  //  The compares are signed, so no char from 128 up is of either class.
+  static
+  const char* findRunEndSse2
+      (const char*  runPtr,
+       const char*  endPtr,
+       charClass_t  charClass
+      )
+      throw()
+      {
+        bool    isSpace = (charClass == SPACE_CHAR_CLASS);
+        const __m128i belowVect = _mm_set1_epi8(isSpace ? '\t' - 1 : '0' - 1);
+        const __m128i aboveVect = _mm_set1_epi8(isSpace ? '\r' + 1 : '9' + 1);
+        const __m128i extraVect = _mm_set1_epi8(isSpace ? ' ' : '0');
+
+        while  (endPtr - runPtr >= 16)
+        {
+          __m128i chars = _mm_loadu_si128((const __m128i*)runPtr);
+          __m128i isOf  = _mm_or_si128
+              (_mm_and_si128(_mm_cmpgt_epi8(chars,belowVect),
+                 _mm_cmpgt_epi8(aboveVect,chars)
+                ),
+               _mm_cmpeq_epi8(chars,extraVect)
+              );
+          unsigned int  notOfMask = ~_mm_movemask_epi8(isOf) & 0xFFFF;
+
+          if  (notOfMask != 0)
+            return(runPtr + __builtin_ctz(notOfMask));
+
+          runPtr  += 16;
+        }
+
+        return(findRunEndScalar(runPtr,endPtr,charClass));
+      }
+
+  //  PURPOSE:  To do as 'findRunEndSse2()', but testing 32 chars at a time
+  //  with AVX2 instructions.  Only to be called if the CPU has them.
+  __attribute__((target("avx2")))
+  static
+  const char* findRunEndAvx2
+      (const char*  runPtr,
+       const char*  endPtr,
+       charClass_t  charClass
+      )
+      throw()
+      {
+        bool    isSpace = (charClass == SPACE_CHAR_CLASS);
+        const __m256i belowVect
+            = _mm256_set1_epi8(isSpace ? '\t' - 1 : '0' - 1);
+        const __m256i aboveVect
+            = _mm256_set1_epi8(isSpace ? '\r' + 1 : '9' + 1);
+        const __m256i extraVect = _mm256_set1_epi8(isSpace ? ' ' : '0');
+
+        while  (endPtr - runPtr >= 32)
+        {
+          __m256i chars = _mm256_loadu_si256((const __m256i*)runPtr);
+          __m256i isOf  = _mm256_or_si256
+              (_mm256_and_si256(_mm256_cmpgt_epi8(chars,belowVect),
+                    _mm256_cmpgt_epi8(aboveVect,chars)
+                   ),
+               _mm256_cmpeq_epi8(chars,extraVect)
+              );
+          unsigned int  notOfMask = ~(unsigned int)_mm256_movemask_epi8(isOf);
+
+          if  (notOfMask != 0)
+            return(runPtr + __builtin_ctz(notOfMask));
+
+          runPtr  += 32;
+        }
+
+        return(findRunEndSse2(runPtr,endPtr,charClass));
+      }
+#endif
+
+  //  PURPOSE:  To do as 'findRunEndScalar()' in the way 'scanMode_' tells.
+  //  Most runs are short (one space, or a small number), so the first
+  //  'SHORT_RUN_LEN' chars are tested one at a time, and vectors are only
+  //  loaded for a run that is longer.
+  const char* findRunEnd  (const char*  runPtr,
+         const char*  endPtr,
+         charClass_t  charClass
+        )
+        const
+      throw()
+      {
+        const char* shortEndPtr = (endPtr - runPtr > SHORT_RUN_LEN)
+                ? runPtr + SHORT_RUN_LEN
+                : endPtr;
+
+        runPtr  = findRunEndScalar(runPtr,shortEndPtr,charClass);
+
+        if  (runPtr < shortEndPtr)
+          return(runPtr);
+
+        switch  (scanMode_)
+        {
+#if defined(__x86_64__)
+        case AVX2_SCAN_MODE :
+          return(findRunEndAvx2(runPtr,endPtr,charClass));
+
+        case SSE2_SCAN_MODE :
+          return(findRunEndSse2(runPtr,endPtr,charClass));
+#endif
+
+        default :
+          return(findRunEndScalar(runPtr,endPtr,charClass));
+        }
+      }
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to read the chars of 'newInput', which
+  //  must outlive '*this'.
+  InputCharStream (const std::string& newInput
+        ) :
+      filePtr_(NULL),
+      cursorPtr_(newInput.data()),
+      endPtr_(newInput.data() + newInput.length()),
+      releasedPtr_(NULL),
+      scanMode_(getBestScanMode())
+      { }
+
+  //  PURPOSE:  To initialize '*this' to read the 'length' chars at 'text',
+  //  which must outlive '*this'.
+  InputCharStream (const char*  text,
+         size_t   length
+        ) :
+      filePtr_(NULL),
+      cursorPtr_(text),
+      endPtr_(text + length),
+      releasedPtr_(NULL),
+      scanMode_(getBestScanMode())
+      { }
+
+  //  PURPOSE:  To initialize '*this' to read the chars of 'mappedFile', which
+  //  must outlive '*this'.
+  InputCharStream (const MappedFile&  mappedFile
+        ) :
+      filePtr_(NULL),
+      cursorPtr_(mappedFile.getText()),
+      endPtr_(mappedFile.getText() + mappedFile.getLength()),
+      releasedPtr_(mappedFile.getText()),
+      scanMode_(getBestScanMode())
+      { }
+
+  //  PURPOSE:  To initialize '*this' to read the chars of 'newFilePtr' in
+  //  chunks.  The caller still owns 'newFilePtr'.
+  InputCharStream (FILE*    newFilePtr
+        ) :
+      filePtr_(newFilePtr),
+      cursorPtr_(buffer_),
+      endPtr_(buffer_),
+      releasedPtr_(NULL),
+      scanMode_(getBestScanMode())
+      { }
+
+  //  PURPOSE:  To return the fastest way this CPU has to skip runs of chars.
+  //  No parameters.
+  static
+  scanMode_t  getBestScanMode
+      ()
+      throw()
+      {
+#if defined(__x86_64__)
+        static const scanMode_t bestScanMode
+          = __builtin_cpu_supports("avx2") ? AVX2_SCAN_MODE : SSE2_SCAN_MODE;
+
+        return(bestScanMode);
+#else
+        return(SCALAR_SCAN_MODE);
+#endif
+      }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return 'true' if '*this' views text held by the caller,
+  //  so that the chars passed stay where they are, or 'false' if it reads
+  //  from a 'FILE*' into a buffer it reuses.
+  bool    isView  ()
+        const
+      throw()
+      { return(filePtr_ == NULL); }
+
+  //  PURPOSE:  To return the address of the current char.  It and the chars
+  //  after it that are available without reading more stay put until more
+  //  are read (or for good if 'isView()').
+  const char* getCursorPtr
+      ()
+        const
+      throw()
+      { return(cursorPtr_); }
+
+  //  PURPOSE:  To return how runs of chars are skipped.
+  scanMode_t  getScanMode ()
+        const
+      throw()
+      { return(scanMode_); }
+
+  //  VI.  Mutators:
+  //  PURPOSE:  To have runs of chars skipped as 'newScanMode' tells.  (On a
+  //  CPU without the instructions it names, runs are skipped one char at a
+  //  time.)  No return value.
+  void    setScanMode (scanMode_t newScanMode
+        )
+      throw()
+      {
+#if defined(__x86_64__)
+        if  ( (newScanMode == AVX2_SCAN_MODE)  &&
+        (getBestScanMode() != AVX2_SCAN_MODE)
+      )
+          newScanMode = SCALAR_SCAN_MODE;
+#else
+        newScanMode = SCALAR_SCAN_MODE;
+#endif
+
+        scanMode_ = newScanMode;
+      }
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To return the current char, or '\0' if there are no more.
+  //  No parameters.
+  char    peek  ()
+      throw(const char*)
+      { return
+        ( ( (cursorPtr_ < endPtr_) || refill() )
+          ? *cursorPtr_ : '\0'
+        );
+      }
+
+  //  PURPOSE:  To return 'true' if at eof-of-input, or 'false' otherwise.
+  bool    isAtEnd ()
+      throw(const char*)
+      { return( (cursorPtr_ >= endPtr_) && !refill() ); }
+
+  //  PURPOSE:  To advance to the next char (if not already at end).  No
+  //  parameters.  No return value.
+  void    advance ()
+        throw(const char*)
+      {
+        if  ( (cursorPtr_ < endPtr_) || refill() )  cursorPtr_++;
+      }
+
+  //  PURPOSE:  To advance past the run of chars of class 'charClass' that
+  //  starts at the current char, but no further than the chars available
+  //  without reading more.  No return value.
+  void    skipAvailable (charClass_t  charClass
+        )
+      throw()
+      { cursorPtr_  = findRunEnd(cursorPtr_,endPtr_,charClass); }
+
+  //  PURPOSE:  To give back the pages of a mapped file that lie wholly
+  //  before the current char, once 'RELEASE_SIZE' chars have been passed,
+  //  so that they are freed now rather than under memory pressure.  Nothing
+  //  viewed before the current char may be used again.  No parameters.  No
+  //  return value.
+  void    releasePassed
+      ()
+      throw()
+      {
+        if  ( (releasedPtr_ == NULL)  ||
+        ((size_t)(cursorPtr_ - releasedPtr_) < RELEASE_SIZE)
+      )
+          return;
+
+        size_t    pageSize  = (size_t)sysconf(_SC_PAGESIZE);
+        const char* endPtr
+          = cursorPtr_ - ((size_t)cursorPtr_ % pageSize);
+
+        madvise((void*)releasedPtr_,endPtr - releasedPtr_,MADV_DONTNEED);
+        releasedPtr_  = endPtr;
+      }
+
+};
+
+
+
+/*  PURPOSE:  To hold the text of the numeric literals scanned for one
+ *  program (or one batch of its statements).  Literals are kept digit for
+ *  digit, so they may be of any length.  A literal scanned from text that
+ *  stays put (see 'InputCharStream::isView()') is just a slice of that
+ *  text, found by its offset from the first slice of the batch; any other
+ *  is copied back to back into one buffer, and its offset is marked by
+ *  'OWNED_OFFSET'.
+ */
+class LiteralPool
+{
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To tell where the offsets of the literals held in 'text_'
+  //  begin.  (Kept under 32 bits so that a 'SyntaxTree' can hold them.)
+  static
+  const
+  size_t    OWNED_OFFSET  = (size_t)1 << 31;
+
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the text of the literals that were copied.
+  std::string   text_;
+
+  //  PURPOSE:  To point to the first slice since the last 'clear()', or to
+  //  be 'NULL' if there is none.
+  const char*   sourcePtr_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No copy constructor:
+  LiteralPool   (const LiteralPool&
+        );
+
+  //  No copy assignment op:
+  LiteralPool&    operator=
+      (const LiteralPool&
+        );
+
+  //  III.  Protected methods:
+protected :
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to hold no literals.  No parameters.
+  LiteralPool   ()
+      throw() :
+      sourcePtr_(NULL)
+      { }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return the number of chars copied.
+  size_t    getLength ()
+        const
+      throw()
+      { return(text_.size()); }
+
+  //  PURPOSE:  To return the address of the first char of 'literal'.
+  const char* getText (const Literal& literal
+        )
+        const
+      throw()
+      {
+        return( (literal.offset_ >= OWNED_OFFSET)
+          ? text_.data() + (literal.offset_ - OWNED_OFFSET)
+          : sourcePtr_ + literal.offset_
+        );
+      }
+
+  //  PURPOSE:  To return the literal of the chars copied since 'firstInd'
+  //  chars were held.
+  Literal   getAppended (size_t   firstInd
+        )
+        const
+      throw()
+      {
+        Literal literal;
+
+        literal.offset_ = OWNED_OFFSET + firstInd;
+        literal.length_ = text_.size() - firstInd;
+        return(literal);
+      }
+
+  //  VI.  Mutators:
+  //  PURPOSE:  To append 'ch' to the text held.  No return value.
+  void    append  (char   ch
+        )
+      throw()
+      { text_ += ch; }
+
+  //  PURPOSE:  To append the 'length' chars at 'textPtr' to the text held.
+  //  No return value.
+  void    append  (const char*  textPtr,
+         size_t   length
+        )
+      throw()
+      { text_.append(textPtr,length); }
+
+  //  PURPOSE:  To append 'text' as a new literal, and to return where it is
+  //  held.
+  Literal   append  (const std::string& text
+        )
+      {
+        Literal literal;
+
+        literal.offset_ = OWNED_OFFSET + text_.size();
+        literal.length_ = text.size();
+        text_   += text;
+        return(literal);
+      }
+
+  //  PURPOSE:  To return the literal of the 'length' chars at 'textPtr',
+  //  which must stay put until the next 'clear()', without copying them.
+  Literal   view    (const char*  textPtr,
+         size_t   length
+        )
+      throw(const char*)
+      {
+        Literal literal;
+
+        if  (sourcePtr_ == NULL)
+          sourcePtr_  = textPtr;
+
+        literal.offset_ = (size_t)(textPtr - sourcePtr_);
+        literal.length_ = length;
+
+        if  (literal.offset_ + length >= OWNED_OFFSET)
+          throw "Literal too far from start of batch";
+
+        return(literal);
+      }
+
+  //  PURPOSE:  To forget every literal held, keeping the buffer to reuse.
+  //  No parameters.  No return value.
+  void    clear ()
+      throw()
+      {
+        text_.clear();
+        sourcePtr_  = NULL;
+      }
+
+};
+
+
+
+//  PURPOSE:  To implement a class that holds the types of the symbols (well,
+//  variables) that occur in the parsed program.  Each variable name is
+//  interned once, when it is scanned, as a dense integer id (0, 1, 2, ...)
+//  found through an open-addressing hash table, so that everything known
+//  about a variable is kept in arrays indexed by its id.
+class SymbolTable
+{
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To tell how many hash slots there are at first.  (Always a
+  //  power of 2.)
+  static
+  const
+  int     INIT_NUM_SLOTS  = 64;
+
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the names of the variables, back to back in id
+  //  order.
+  std::string   nameText_;
+
+  //  PURPOSE:  To hold, for each id, where in 'nameText_' its name ends.
+  std::vector<size_t>
+      nameEndVect_;
+
+  //  PURPOSE:  To hold the hash slots, each the id of a name or -1.
+  std::vector<int>
+      slotVect_;
+
+  //  PURPOSE:  To hold the type of each variable.
+  std::vector<dcType_t>
+      typeVect_;
+
+  //  PURPOSE:  To tell, for each variable, if it may have been given a value
+  //  with digits after the point.  (Only the first value assigned to an int
+  //  var is checked to be an int, so one can still be given, e.g., 1 + 2.5.)
+  std::vector<bool>
+      mayHaveFractionVect_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No copy constructor:
+  SymbolTable   (const SymbolTable&
+        );
+
+  //  No copy assignment op:
+  SymbolTable&    operator=
+      (const SymbolTable&
+        );
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To return the hash of the 'length' chars at 'name'.
+  static
+  unsigned int  hash  (const char*  name,
+         size_t   length
+        )
+      throw()
+      {
+        unsigned int  toReturn  = 2166136261u;
+
+        for  (size_t i = 0;  i < length;  i++)
+          toReturn  = (toReturn ^ (unsigned char)name[i]) * 16777619u;
+
+        return(toReturn);
+      }
+
+  //  PURPOSE:  To return the index in 'slotVect_' that holds the id of the
+  //  'length' chars at 'name', or of the empty slot where it would go.
+  size_t    findSlot  (const char*  name,
+         size_t   length
+        )
+        const
+      throw()
+      {
+        size_t  mask    = slotVect_.size() - 1;
+
+        for  (size_t i = hash(name,length) & mask; ;  i = (i + 1) & mask)
+        {
+          int id  = slotVect_[i];
+
+          if  ( (id < 0)  ||
+          ( (getNameLength(id) == length)  &&
+            (memcmp(getName(id),name,length) == 0)
+          )
+        )
+            return(i);
+        }
+      }
+
+  //  PURPOSE:  To double the number of hash slots.  No parameters.  No
+  //  return value.
+  void    grow  ()
+      {
+        slotVect_.assign(2 * slotVect_.size(),-1);
+
+        for  (int id = 0;  id < getNumVars();  id++)
+          slotVect_[findSlot(getName(id),getNameLength(id))]  = id;
+      }
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' table to hold no symbols.  No parameters.
+  //  No return value.
+  SymbolTable   ()
+      throw()
+        {
+        clear();
+      }
+
+  ~SymbolTable    ()
+      { }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return how many variable names have been interned, i.e.
+  //  one more than the largest id.
+  int     getNumVars  ()
+        const
+      throw()
+      { return((int)nameEndVect_.size()); }
+
+  //  PURPOSE:  To return the address of the first char of the name of the
+  //  variable with id 'id'.
+  const char* getName (int    id
+        )
+        const
+      throw()
+      { return(nameText_.data() + ((id == 0) ? 0 : nameEndVect_[id-1])); }
+
+  //  PURPOSE:  To return the length of the name of the variable with id 'id'.
+  size_t    getNameLength
+      (int    id
+      )
+        const
+      throw()
+      { return(nameEndVect_[id] - ((id == 0) ? 0 : nameEndVect_[id-1])); }
+
+  //  PURPOSE:  To return 'true' if the variable named by the 'length' chars
+  //  at 'name' has been declared, or 'false' otherwise.
+  bool    isDeclared  (const char*  name,
+         size_t   length
+        )
+        const
+      throw()
+      {
+        int id  = slotVect_[findSlot(name,length)];
+
+        return( (id >= 0)  &&  (typeVect_[id] != NULL_DC_TYPE) );
+      }
+
+  //  PURPOSE:  To return 'true' if the variable with id 'id' may have been
+  //  given a value with digits after the point, or 'false' otherwise.
+  bool    getMayHaveFraction
+      (int    id
+      )
+        const
+      throw()
+      {
+        return( (typeVect_[id] == FLOAT_POINT_DC_TYPE)  ||
+          mayHaveFractionVect_[id]
+        );
+      }
+
+  //  VI.  Mutators:
+
+  //  PURPOSE:  To make '*this' table hold no symbols again.  No parameters.
+  //  No return value.
+  void    clear ()
+      throw()
+      {
+        nameText_.clear();
+        nameEndVect_.clear();
+        slotVect_.assign(INIT_NUM_SLOTS,-1);
+        typeVect_.clear();
+        mayHaveFractionVect_.clear();
+      }
+
+  //  PURPOSE:  To forget the types of all variables (but not their names
+  //  or ids).  No parameters.  No return value.
+  void    clearTypes  ()
+      throw()
+      {
+        typeVect_.assign(typeVect_.size(),NULL_DC_TYPE);
+        mayHaveFractionVect_.assign(mayHaveFractionVect_.size(),false);
+      }
+
+  //  PURPOSE:  To note that the variable with id 'id' may have been given a
+  //  value with digits after the point.  No return value.
+  void    noteMayHaveFraction
+      (int    id
+      )
+      throw()
+      { mayHaveFractionVect_[id]  = true; }
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To return the id of the variable named by the 'length' chars
+  //  at 'name', giving it the next id if it has none yet.
+  int     intern  (const char*  name,
+         size_t   length
+        )
+      {
+        size_t  slot  = findSlot(name,length);
+
+        if  (slotVect_[slot] >= 0)
+          return(slotVect_[slot]);
+
+        int id  = getNumVars();
+
+        nameText_.append(name,length);
+        nameEndVect_.push_back(nameText_.size());
+        typeVect_.push_back(NULL_DC_TYPE);
+        mayHaveFractionVect_.push_back(false);
+        slotVect_[slot] = id;
+
+        if  (2 * getNumVars() >= (int)slotVect_.size())
+          grow();
+
+        return(id);
+      }
+
+  //  PURPOSE:  To store the type of the variable with id 'id' as being
+  //  'varType', assuming there is no type already recorded.  No return
+  //  value.
+  void    enter (dcType_t varType,
+         int    id
+        )
+      throw(const char*)
+      {
+        if  (typeVect_[id] != NULL_DC_TYPE) {
+          snprintf(errorMessage,256,"Attempt to redefine symbol %.*s",
+             (int)getNameLength(id),getName(id)
+            );
+          throw errorMessage;
+          //throw "Attempt to redefine symbol";
         }
           
-        typeArray_[index] = varType;
+        typeVect_[id] = varType;
+      }
+
+  //  PURPOSE:  To return the type that is recorded for the variable with id
+  //  'id'.
+  dcType_t  lookUp  (int    id
+        )
+      throw(const char*)
+      {
+        return(typeVect_[id]);
+      }
+
+};
+
+
+
+//  PURPOSE:  To implement an interface that gathers characters into lexemes.
+//  Lexemes are handed back as 'Symbol' values; nothing is allocated.
+class TokenStream
+{
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the source of the character input.
+  InputCharStream&  inputCharStream_;
+
+  //  PURPOSE:  To hold the text of the numeric literals scanned.
+  LiteralPool&    literalPool_;
+
+  //  PURPOSE:  To intern the names of the identifiers scanned.
+  SymbolTable&    symbolTable_;
+
+  //  PURPOSE:  To hold the text of the identifier being scanned.
+  std::string   nameText_;
+
+  //  PURPOSE:  To hold the lastest lexeme parsed.
+  Symbol      lastParsed_;
+
+  //  PURPOSE:  To point to the first char of the lexeme 'lastParsed_' was
+  //  scanned from (or to the end of the input).
+  const char*   lastParsedPtr_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No default constructor:
+  TokenStream   ();
+
+  //  No copy constructor:
+  TokenStream   (const TokenStream&
+      );
+
+  //  No copy assignment op:
+  TokenStream&    operator=
+      (const TokenStream&
+      );
+
+protected :
+  //  III.  Protected methods:
+  //  PURPOSE:  To pass the run of digits at the front of 'inputCharStream_',
+  //  appending them to 'literalPool_' unless they stay put.  The run is
+  //  skipped in bulk, a piece per read of the input.  No parameters.  No
+  //  return value.
+  void    appendDigits
+      ()
+      throw(const char*)
+      {
+        bool  isView  = inputCharStream_.isView();
+
+        while  ( isdigit(inputCharStream_.peek()) )
+        {
+          const char* firstPtr  = inputCharStream_.getCursorPtr();
+
+          inputCharStream_.skipAvailable(DIGIT_CHAR_CLASS);
+
+          if  (!isView)
+            literalPool_.append(firstPtr,
+              inputCharStream_.getCursorPtr() - firstPtr
+             );
+        }
+      }
+
+  //  PURPOSE:  To return a 'Symbol' representing a scanned number, either an
+  //  integer or floating point.  The lexeme is kept, exactly as written, in
+  //  'literalPool_': as a slice of the input if it stays put, or else as a
+  //  copy.  No parameters.
+  Symbol      scanDigits
+      ()
+      throw(const char*)
+      {
+        Symbol    symbol;
+        const char* firstPtr  = inputCharStream_.getCursorPtr();
+        size_t    firstInd  = literalPool_.getLength();
+
+        appendDigits();
+
+        if  (inputCharStream_.peek() != '.')
+          symbol.symbol_  = INT_SYMBOL;
+        else
+        {
+          if  ( !inputCharStream_.isView() )
+            literalPool_.append('.');
+
+          inputCharStream_.advance();
+          appendDigits();
+          symbol.symbol_  = FLOAT_SYMBOL;
+        }
+
+        symbol.value_.literal_
+          = inputCharStream_.isView()
+            ? literalPool_.view(firstPtr,
+                inputCharStream_.getCursorPtr() - firstPtr
+               )
+            : literalPool_.getAppended(firstInd);
+        return(symbol);
+      }
+
+  //  PURPOSE:  To return a 'Symbol' representing a scanned identifier or
+  //  keyword.  An identifier is a letter followed by letters, digits and
+  //  '_'.  The keywords are the single letters "i", "f" and "p", so any
+  //  longer name (e.g. "fb") is one identifier.  The name is looked up as a
+  //  slice of the input if it stays put, or else as a copy.  No parameters.
+  Symbol      scanIdentifier
+      ()
+      throw(const char*)
+      {
+        Symbol    symbol;
+        bool      isView    = inputCharStream_.isView();
+        const char* namePtr   = inputCharStream_.getCursorPtr();
+        size_t    nameLength;
+
+        nameText_.clear();
+
+        do
+        {
+          if  (!isView)
+            nameText_ += inputCharStream_.peek();
+
+          inputCharStream_.advance();
+        }
+        while  ( isalnum(inputCharStream_.peek())  ||
+           (inputCharStream_.peek() == '_')
+         );
+
+        if  (isView)
+          nameLength  = inputCharStream_.getCursorPtr() - namePtr;
+        else
+        {
+          namePtr   = nameText_.data();
+          nameLength  = nameText_.size();
+        }
+
+        if  (nameLength == 1)
+        {
+          switch  (namePtr[0])
+          {
+          case 'p' :
+            symbol.symbol_  = PRINT_SYMBOL;
+            return(symbol);
+
+          case 'i' :
+            symbol.symbol_  = INT_DECLARE_SYMBOL;
+            return(symbol);
+
+          case 'f' :
+            symbol.symbol_  = FLOAT_DECLARE_SYMBOL;
+            return(symbol);
+          }
+        }
+
+        symbol.symbol_    = ID_SYMBOL;
+        symbol.value_.varId_  = symbolTable_.intern(namePtr,nameLength);
+        return(symbol);
+      }
+
+
+  //  PURPOSE:  To return a 'Symbol' representing the next scanned lexeme, or
+  //  to return 'endSymbol' if the '*this' is at the end-of-input.  No
+  //  parameters.
+  Symbol  scanner ()
+      throw(const char*)
+        {
+        while  ( isspace(inputCharStream_.peek()) )
+          inputCharStream_.skipAvailable(SPACE_CHAR_CLASS);
+
+        lastParsedPtr_  = inputCharStream_.getCursorPtr();
+
+        if  ( inputCharStream_.isAtEnd() )
+          return( endSymbol );
+
+        if  ( isdigit(inputCharStream_.peek()) )
+          return( scanDigits() );
+
+        if  ( isalpha(inputCharStream_.peek()) )
+          return( scanIdentifier() );
+
+        char      ch    = inputCharStream_.peek();
+        Symbol    symbol;
+
+        inputCharStream_.advance();
+
+        switch  (ch)
+        {
+        case '=' :
+          symbol.symbol_  = ASSIGN_SYMBOL;
+          break;
+
+        case '+' :
+          symbol.symbol_  = ADD_SYMBOL;
+          break;
+
+        case '-' :
+          symbol.symbol_  = SUBTRACT_SYMBOL;
+          break;
+
+        default :
+          throw "Unexpected character in input";
+        }
+
+        return(symbol);
+      }
+
+public :
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to read from 'newInputCharStream',
+  //  keeping the text of numeric literals in 'newLiteralPool' and interning
+  //  identifiers in 'newSymbolTable'.
+  TokenStream   (InputCharStream& newInputCharStream,
+         LiteralPool&   newLiteralPool,
+         SymbolTable&   newSymbolTable
+        )
+      throw(const char*) :
+      inputCharStream_(newInputCharStream),
+      literalPool_(newLiteralPool),
+      symbolTable_(newSymbolTable)
+      {
+        lastParsed_ = scanner();
+      }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return the address of the first char of the lexeme of the
+  //  'Symbol' that is next in the symbol stream (or of the end of the
+  //  input).  Only meaningful if the input 'isView()'.
+  const char* getPeekedPtr
+      ()
+        const
+      throw()
+      { return(lastParsedPtr_); }
+
+  //  VI.  Mutators:
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To return the 'symbol_t' of the 'Symbol' instance that is next
+  //  in the symbol stream.  No parameters.
+  symbol_t    peek  ()
+        const
+      throw()
+      {
+        return(lastParsed_.symbol_);
+      }
+
+  //  PURPOSE:  To return the 'Symbol' that was at the front of the symbol
+  //  stream, and then to internally advance to the next one (if not already
+  //  at the end).  No parameters.
+  Symbol  advance ()
+        throw(const char*)
+      {
+        Symbol  toReturn  = lastParsed_;
+
+        lastParsed_ = scanner();
+        return(toReturn);
+      }
+
+  //  PURPOSE:  To let the input already scanned be given back (see
+  //  'InputCharStream::releasePassed()'), once no literal scanned from it
+  //  is used any more.  No parameters.  No return value.
+  void    releasePassedInput
+      ()
+      throw()
+      { inputCharStream_.releasePassed(); }
+
+};
+
+
+//  PURPOSE:  To hold the 'dc' code for a sequence of statements as
+//  instructions rather than text, so that it may be improved before it is
+//  written.
+class DcCode
+{
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To tell how many registers there are for the variables with
+  //  longer names before they spill to the arrays of those registers.
+  static
+  const
+  int     NUM_NAME_REGISTERS  = 26;
+
+  //  PURPOSE:  To tell how many elements of each register's array are used.
+  static
+  const
+  int     ARRAY_LENGTH    = 2048;
+
+  //  PURPOSE:  To tell where the array slots start among the values of
+  //  'registerVect_'.  (Values below it are register chars.)
+  static
+  const
+  int     FIRST_ARRAY_SLOT  = 256;
+
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the names of the variables.
+  const SymbolTable&  symbolTable_;
+
+  //  PURPOSE:  To hold, for each variable id, the register char that holds
+  //  it, or 'FIRST_ARRAY_SLOT' plus its slot in the register arrays, or -1
+  //  if it has not been given either yet.  A one letter variable is kept in
+  //  the register of that letter, as 'dc' users would expect; longer names
+  //  get those of the registers 'A' to 'Z' whose letter is not declared as
+  //  a variable, and then elements of their arrays.
+  std::vector<int>
+      registerVect_;
+
+  //  PURPOSE:  To hold how many of the registers 'A' to 'Z' and then array
+  //  slots have been given to variables with longer names or skipped.
+  int     numNamesPlaced_;
+
+  //  PURPOSE:  To hold the instructions, in order.
+  std::vector<DcInstruction>
+      instructionVect_;
+
+  //  PURPOSE:  To hold the text of the numbers pushed, back to back.
+  std::string   literalText_;
+
+  //  PURPOSE:  To hold the 'k' precision in effect after the instructions
+  //  already written, or -1 if not known.
+  int     precision_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No copy constructor:
+  DcCode    (const DcCode&
+        );
+
+  //  No copy assignment op:
+  DcCode&   operator=
+      (const DcCode&
+        );
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To return the value of 'registerVect_' for variable 'varId',
+  //  placing the variable first if it has not been placed yet.  All the
+  //  variables must have been declared by then, so that no longer name is
+  //  given the register of a one letter variable.
+  int     getRegister (int    varId
+        )
+      throw(const char*)
+      {
+        if  (varId >= (int)registerVect_.size())
+          registerVect_.resize(symbolTable_.getNumVars(),-1);
+
+        int&  reg = registerVect_[varId];
+
+        if  (reg >= 0)
+          return(reg);
+
+        if  (symbolTable_.getNameLength(varId) == 1)
+        {
+          reg = (unsigned char)*symbolTable_.getName(varId);
+          return(reg);
+        }
+
+        //  Skip the registers of declared one letter variables:
+        for  ( ;  numNamesPlaced_ < NUM_NAME_REGISTERS;  numNamesPlaced_++)
+        {
+          char  letter  = (char)('A' + numNamesPlaced_);
+
+          if  ( !symbolTable_.isDeclared(&letter,1) )
+            break;
+        }
+
+        if  (numNamesPlaced_ < NUM_NAME_REGISTERS)
+          reg = 'A' + numNamesPlaced_++;
+        else
+        {
+          int slot  = numNamesPlaced_++ - NUM_NAME_REGISTERS;
+
+          if  (slot >= NUM_NAME_REGISTERS * ARRAY_LENGTH)
+            throw "Too many variables";
+
+          reg = FIRST_ARRAY_SLOT + slot;
+        }
+
+        return(reg);
+      }
+
+  //  PURPOSE:  To write to 'out' the 'dc' text that does 'op' (a load or a
+  //  store) on the register or array slot 'reg' from 'registerVect_'.  No
+  //  return value.
+  static
+  void    writeVar  (std::ostream&  out,
+         dcOp_t   op,
+         int    reg
+        )
+      {
+        if  (reg < FIRST_ARRAY_SLOT)
+          out << ((op == LOAD_DC_OP) ? 'l' : 's') << (char)reg << '\n';
+        else
+        {
+          int slot  = reg - FIRST_ARRAY_SLOT;
+
+          out << (slot % ARRAY_LENGTH)
+        << ((op == LOAD_DC_OP) ? ';' : ':')
+        << (char)('A' + slot / ARRAY_LENGTH) << '\n';
+        }
+      }
+
+  //  PURPOSE:  To remove the instructions whose 'op_' is 'NO_DC_OP'.  No
+  //  parameters.  No return value.
+  void    compact ()
+      throw()
+      {
+        size_t  toInd   = 0;
+
+        for  (size_t fromInd = 0;  fromInd < instructionVect_.size();  fromInd++)
+          if  (instructionVect_[fromInd].op_ != NO_DC_OP)
+            instructionVect_[toInd++] = instructionVect_[fromInd];
+
+        instructionVect_.resize(toInd);
+      }
+
+  //  PURPOSE:  To remove each 'k' instruction that sets the precision that
+  //  is already in effect.  No parameters.  No return value.
+  void    removeRedundantPrecisions
+      ()
+      throw()
+      {
+        for  (size_t i = 0;  i < instructionVect_.size();  i++)
+        {
+          DcInstruction&  instr = instructionVect_[i];
+
+          if  (instr.op_ != PRECISION_DC_OP)
+            continue;
+
+          if  (instr.value_.integer_ == precision_)
+            instr.op_ = NO_DC_OP;
+          else
+            precision_  = instr.value_.integer_;
+        }
+      }
+
+  //  PURPOSE:  To turn each store to a register that is immediately followed
+  //  by a load of it into a duplicate and a store.  No parameters.  No
+  //  return value.
+  void    fuseStoreLoads
+      ()
+      throw()
+      {
+        for  (size_t i = 1;  i < instructionVect_.size();  i++)
+        {
+          DcInstruction&  storeInstr  = instructionVect_[i-1];
+          DcInstruction&  loadInstr = instructionVect_[i];
+
+          if  ( (storeInstr.op_ == STORE_DC_OP) &&
+          (loadInstr.op_  == LOAD_DC_OP)  &&
+          (storeInstr.value_.varId_ == loadInstr.value_.varId_)
+        )
+          {
+            loadInstr     = storeInstr;
+            storeInstr.op_    = DUPLICATE_DC_OP;
+          }
+        }
+      }
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to hold no instructions, with the
+  //  precision 'dc' starts with, naming variables as in 'newSymbolTable'.
+  DcCode    (const SymbolTable& newSymbolTable
+        )
+      throw() :
+      symbolTable_(newSymbolTable),
+      numNamesPlaced_(0),
+      precision_(0)
+      { }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return the number of instructions held.
+  size_t    getNumInstructions
+      ()
+        const
+      throw()
+      { return(instructionVect_.size()); }
+
+  //  PURPOSE:  To return the 'i'-th instruction.
+  const DcInstruction&
+      getInstruction
+      (size_t   i
+      )
+        const
+      throw()
+      { return(instructionVect_[i]); }
+
+  //  PURPOSE:  To return the address of the first char of the text of the
+  //  number pushed by 'instr'.
+  const char* getNumberText
+      (const DcInstruction& instr
+      )
+        const
+      throw()
+      { return(literalText_.data() + instr.value_.literal_.offset_); }
+
+  //  VI.  Mutators:
+  //  PURPOSE:  To append an instruction that does 'op'.  No return value.
+  void    append  (dcOp_t   op
+        )
+      throw()
+      {
+        DcInstruction instr;
+
+        instr.op_   = op;
+        instructionVect_.push_back(instr);
+      }
+
+  //  PURPOSE:  To append an instruction that does 'op' with integer
+  //  'integer'.  No return value.
+  void    appendInt (dcOp_t   op,
+         int    integer
+        )
+      throw()
+      {
+        DcInstruction instr;
+
+        instr.op_     = op;
+        instr.value_.integer_ = integer;
+        instructionVect_.push_back(instr);
+      }
+
+  //  PURPOSE:  To append an instruction that pushes the number written as
+  //  the 'length' chars at 'text'.  No return value.
+  void    appendNumber  (const char*  text,
+         size_t   length
+        )
+      throw()
+      {
+        DcInstruction instr;
+
+        instr.op_       = PUSH_NUMBER_DC_OP;
+        instr.value_.literal_.offset_ = literalText_.size();
+        instr.value_.literal_.length_ = length;
+        literalText_.append(text,length);
+        instructionVect_.push_back(instr);
+      }
+
+  //  PURPOSE:  To append an instruction that does 'op' on the register of
+  //  the variable with id 'varId'.  No return value.
+  void    appendVar (dcOp_t   op,
+         int    varId
+        )
+      throw()
+      {
+        DcInstruction instr;
+
+        instr.op_     = op;
+        instr.value_.varId_ = varId;
+        instructionVect_.push_back(instr);
+      }
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To rewrite the held instructions into fewer that do the same.
+  //  No parameters.  No return value.
+  void    optimize  ()
+      throw()
+      {
+        removeRedundantPrecisions();
+        compact();
+        fuseStoreLoads();
+      }
+
+  //  PURPOSE:  To forget the held instructions.  No parameters.  No return
+  //  value.
+  void    clear ()
+      throw()
+      {
+        instructionVect_.clear();
+        literalText_.clear();
+      }
+
+  //  PURPOSE:  To forget which registers the variables were given, so that
+  //  they are placed again, from the first, as they are next written.  No
+  //  parameters.  No return value.
+  void    forgetRegisters
+      ()
+      throw()
+      {
+        registerVect_.clear();
+        numNamesPlaced_ = 0;
+      }
+
+  //  PURPOSE:  To write the held instructions to 'out' as 'dc' text.  No
+  //  return value.
+  void    write (std::ostream&  out
+        )
+      throw(const char*)
+      {
+        for  (size_t i = 0;  i < instructionVect_.size();  i++)
+        {
+          const DcInstruction&  instr = instructionVect_[i];
+
+          switch  (instr.op_)
+          {
+          case PUSH_NUMBER_DC_OP :
+            out.write(getNumberText(instr),instr.value_.literal_.length_);
+            out << '\n';
+            break;
+
+          case LOAD_DC_OP :
+          case STORE_DC_OP :
+            writeVar(out,instr.op_,getRegister(instr.value_.varId_));
+            break;
+
+          case DUPLICATE_DC_OP :
+            out << "d\n";
+            break;
+
+          case ADD_DC_OP :
+            out << "+\n";
+            break;
+
+          case SUBTRACT_DC_OP :
+            out << "-\n";
+            break;
+
+          case PRINT_DC_OP :
+            out << "p\n";
+            break;
+
+          case DISCARD_DC_OP :
+            out << "si\n";
+            break;
+
+          case PRECISION_DC_OP :
+            out << instr.value_.integer_ << " k\n";
+            break;
+
+          case NO_DC_OP :
+            break;
+          }
+        }
+      }
+
+};
+
+
+/*  PURPOSE:  To hold one arbitrary precision 'dc' number: a decimal of the
+ *  form (magnitude / 10^'scale_'), negated if 'isNegative_'.  The magnitude
+ *  is kept in base 10^18 limbs, least significant first, with no most
+ *  significant zero limbs (so zero has none).
+ */
+class BigDecimal
+{
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To tell how many decimal digits each limb holds.
+  static
+  const
+  int     LIMB_NUM_DIGITS = 18;
+
+  //  PURPOSE:  To tell the value one more than a limb can hold.
+  static
+  const
+  unsigned long long
+      LIMB_BASE = 1000000000000000000ULL;
+
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the limbs of the magnitude.
+  std::vector<unsigned long long>
+      limbVect_;
+
+  //  PURPOSE:  To hold how many of the decimal digits are after the point.
+  int     scale_;
+
+  //  PURPOSE:  To tell if the number is less than 0.
+  bool      isNegative_;
+
+  //  II.  Disallowed auto-generated methods:
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To return 10^'power', for 'power' in [0,LIMB_NUM_DIGITS).
+  static
+  unsigned long long
+      powerOf10 (int    power
+        )
+      throw()
+      {
+        unsigned long long  toReturn  = 1;
+
+        while  (power-- > 0)
+          toReturn  *= 10;
+
+        return(toReturn);
+      }
+
+  //  PURPOSE:  To remove the most significant zero limbs, and to make zero
+  //  non-negative.  No parameters.  No return value.
+  void    trim  ()
+      throw()
+      {
+        while  ( !limbVect_.empty()  &&  (limbVect_.back() == 0) )
+          limbVect_.pop_back();
+
+        if  (limbVect_.empty())
+          isNegative_ = false;
+      }
+
+  //  PURPOSE:  To return a negative number, 0 or a positive number when the
+  //  magnitude of '*this' is less than, equal to or more than that of
+  //  'rhs', which must have the same scale.
+  int     compareMagnitude
+      (const BigDecimal&  rhs
+      )
+        const
+      throw()
+      {
+        if  (limbVect_.size() != rhs.limbVect_.size())
+          return( (limbVect_.size() < rhs.limbVect_.size()) ? -1 : +1 );
+
+        for  (size_t i = limbVect_.size();  i-- > 0; )
+          if  (limbVect_[i] != rhs.limbVect_[i])
+            return( (limbVect_[i] < rhs.limbVect_[i]) ? -1 : +1 );
+
+        return(0);
+      }
+
+  //  PURPOSE:  To add the magnitude of 'rhs' to that of '*this'.  No return
+  //  value.
+  void    addMagnitude
+      (const BigDecimal&  rhs
+      )
+      {
+        if  (limbVect_.size() < rhs.limbVect_.size())
+          limbVect_.resize(rhs.limbVect_.size(),0);
+
+        unsigned long long  carry = 0;
+
+        for  (size_t i = 0;  i < limbVect_.size();  i++)
+        {
+          limbVect_[i]  += carry
+              + ( (i < rhs.limbVect_.size()) ? rhs.limbVect_[i] : 0 );
+          carry   = (limbVect_[i] >= LIMB_BASE) ? 1 : 0;
+
+          if  (carry != 0)
+            limbVect_[i]  -= LIMB_BASE;
+        }
+
+        if  (carry != 0)
+          limbVect_.push_back(carry);
+      }
+
+  //  PURPOSE:  To subtract the magnitude of 'rhs' from that of '*this',
+  //  which must not be less.  No return value.
+  void    subtractMagnitude
+      (const BigDecimal&  rhs
+      )
+      throw()
+      {
+        unsigned long long  borrow  = 0;
+
+        for  (size_t i = 0;  i < limbVect_.size();  i++)
+        {
+          unsigned long long
+            toSubtract  = borrow
+              + ( (i < rhs.limbVect_.size()) ? rhs.limbVect_[i] : 0 );
+
+          borrow    = (limbVect_[i] < toSubtract) ? 1 : 0;
+          limbVect_[i]  += borrow * LIMB_BASE - toSubtract;
+        }
+
+        trim();
+      }
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to 0.  No parameters.
+  BigDecimal    ()
+      throw() :
+      scale_(0),
+      isNegative_(false)
+      { }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return 'true' if '*this' is 0, or 'false' otherwise.
+  bool    isZero  ()
+        const
+      throw()
+      { return(limbVect_.empty()); }
+
+  //  PURPOSE:  To return how many decimal digits are after the point.
+  int     getScale  ()
+        const
+      throw()
+      { return(scale_); }
+
+  //  PURPOSE:  To return 'true' if '*this' is less than 0.
+  bool    getIsNegative
+      ()
+        const
+      throw()
+      { return(isNegative_); }
+
+  //  PURPOSE:  To append the decimal digits of the magnitude of '*this' to
+  //  'text', most significant first, without leading zeros ("" for 0).  No
+  //  return value.
+  void    appendDigits
+      (std::string& text
+      )
+        const
+      {
+        char  limbText[LIMB_NUM_DIGITS+1];
+
+        for  (size_t i = limbVect_.size();  i-- > 0; )
+        {
+          snprintf(limbText,sizeof(limbText),
+             (i == limbVect_.size()-1) ? "%llu" : "%018llu",
+             limbVect_[i]
+            );
+          text  += limbText;
+        }
+      }
+
+  //  PURPOSE:  To append '*this' to 'text' the way a 'dc' program writes a
+  //  number: led by '_' if negative, with all 'scale_' digits after the
+  //  point.  No return value.
+  void    appendLiteral
+      (std::string& text
+      )
+        const
+      {
+        std::string digits;
+
+        appendDigits(digits);
+
+        if  ( (int)digits.length() <= scale_ )
+          digits.insert(0,scale_ + 1 - digits.length(),'0');
+
+        if  (isNegative_)
+          text  += '_';
+
+        text.append(digits,0,digits.length() - scale_);
+
+        if  (scale_ > 0)
+        {
+          text  += '.';
+          text.append(digits,digits.length() - scale_,std::string::npos);
+        }
+      }
+
+  //  VI.  Mutators:
+  //  PURPOSE:  To set '*this' to 0, keeping its limbs to reuse.  No
+  //  parameters.  No return value.
+  void    clear ()
+      throw()
+      {
+        limbVect_.clear();
+        scale_    = 0;
+        isNegative_ = false;
+      }
+
+  //  PURPOSE:  To set '*this' to the number written as the 'length' chars
+  //  at 'text': digits with at most one '.', led by '_' or '-' if negative.
+  //  No return value.
+  void    setText (const char*  text,
+         size_t   length
+        )
+      {
+        const char* endPtr  = text + length;
+
+        isNegative_ = (length > 0)  &&  ( (*text == '_') || (*text == '-') );
+
+        if  (isNegative_)
+          text++;
+
+        const char* pointPtr  = (const char*)memchr(text,'.',endPtr - text);
+
+        scale_    = (pointPtr == NULL) ? 0 : (int)(endPtr - pointPtr - 1);
+        limbVect_.clear();
+
+        unsigned long long  limb    = 0;
+        unsigned long long  placeValue  = 1;
+
+        for  (const char* cPtr = endPtr;  cPtr-- > text; )
+        {
+          if  (*cPtr == '.')
+            continue;
+
+          limb    += (*cPtr - '0') * placeValue;
+          placeValue  *= 10;
+
+          if  (placeValue == LIMB_BASE)
+          {
+            limbVect_.push_back(limb);
+            limb    = 0;
+            placeValue  = 1;
+          }
+        }
+
+        limbVect_.push_back(limb);
+        trim();
+      }
+
+  //  PURPOSE:  To make '*this' have scale 'newScale', which must not be
+  //  less than its scale, without changing its value.  No return value.
+  void    rescale (int    newScale
+        )
+      {
+        if  (newScale <= scale_)
+          return;
+
+        int     shift   = newScale - scale_;
+
+        scale_    = newScale;
+
+        if  (isZero())
+          return;
+
+        limbVect_.insert(limbVect_.begin(),shift / LIMB_NUM_DIGITS,0);
+
+        unsigned long long  multiplier  = powerOf10(shift % LIMB_NUM_DIGITS);
+        unsigned long long  carry   = 0;
+
+        if  (multiplier == 1)
+          return;
+
+        for  (size_t i = 0;  i < limbVect_.size();  i++)
+        {
+          unsigned __int128 product = (unsigned __int128)limbVect_[i]
+                * multiplier + carry;
+
+          limbVect_[i]  = (unsigned long long)(product % LIMB_BASE);
+          carry   = (unsigned long long)(product / LIMB_BASE);
+        }
+
+        if  (carry != 0)
+          limbVect_.push_back(carry);
+      }
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To add 'rhs' to '*this', or to subtract it if 'isSubtract' is
+  //  'true'.  The result has the larger scale of the two, as in 'dc'.  May
+  //  rescale 'rhs'.  No return value.
+  void    add (BigDecimal&  rhs,
+         bool   isSubtract
+        )
+      {
+        bool  isRhsNegative = (rhs.isNegative_ != isSubtract)
+              &&  !rhs.isZero();
+
+        rescale(rhs.scale_);
+        rhs.rescale(scale_);
+
+        if  (isNegative_ == isRhsNegative)
+        {
+          addMagnitude(rhs);
+          isNegative_ = isRhsNegative;
+        }
+        else
+        if  (compareMagnitude(rhs) >= 0)
+          subtractMagnitude(rhs);
+        else
+        {
+          limbVect_.swap(rhs.limbVect_);
+          subtractMagnitude(rhs);
+          isNegative_ = isRhsNegative;
+        }
+
+        trim();
+      }
+
+  //  PURPOSE:  To exchange the values of '*this' and 'rhs' without copying
+  //  their limbs.  No return value.
+  void    swap  (BigDecimal&  rhs
+        )
+      throw()
+      {
+        limbVect_.swap(rhs.limbVect_);
+        std::swap(scale_,rhs.scale_);
+        std::swap(isNegative_,rhs.isNegative_);
+      }
+
+};
+
+
+//  PURPOSE:  To run 'dc' instructions in-process, with the meaning 'dc'
+//  gives them: each number is an arbitrary precision decimal, and '+' and
+//  '-' keep the larger scale of their operands.
+class DcMachine
+{
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To tell how many chars 'dc' puts on a line of output before
+  //  continuing it with a backslash.
+  static
+  const
+  int     LINE_LENGTH = 70;
+
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the value of each variable, indexed by its id.  An
+  //  empty register reads as 0, as in 'dc'.
+  std::vector<BigDecimal>
+      registerVect_;
+
+  //  PURPOSE:  To hold the last value discarded after printing (what 'dc'
+  //  keeps in register 'i').
+  BigDecimal    discarded_;
+
+  //  PURPOSE:  To hold the operand stack.  Only the first 'stackSize_' slots
+  //  are in use; the rest are kept so that their limbs may be reused.
+  std::vector<BigDecimal>
+      stack_;
+
+  //  PURPOSE:  To hold how many slots of 'stack_' are in use.
+  size_t    stackSize_;
+
+  //  PURPOSE:  To hold the 'k' precision.  Only kept for fidelity: '+' and
+  //  '-' do not depend on it.
+  int     precision_;
+
+  //  PURPOSE:  To hold the digits of the number being printed.
+  std::string   digits_;
+
+  //  PURPOSE:  To hold where 'p' writes.
+  std::ostream&   out_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No default constructor:
+  DcMachine   ();
+
+  //  No copy constructor:
+  DcMachine   (const DcMachine&
+        );
+
+  //  No copy assignment op:
+  DcMachine&    operator=
+      (const DcMachine&
+        );
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To return a reference to a new slot on top of 'stack_', whose
+  //  value is whatever it last held.  No parameters.
+  BigDecimal&   push  ()
+      {
+        if  (stackSize_ == stack_.size())
+          stack_.resize(stackSize_ + 1);
+
+        return(stack_[stackSize_++]);
+      }
+
+  //  PURPOSE:  To return a reference to the number 'depth' slots below the
+  //  top of 'stack_' (0 is the top).
+  BigDecimal&   peek  (size_t depth
+        )
+      throw(const char*)
+      {
+        if  (depth >= stackSize_)
+          throw "dc stack empty";
+
+        return(stack_[stackSize_ - 1 - depth]);
+      }
+
+  //  PURPOSE:  To return a reference to the register of the variable with id
+  //  'varId', making room for it if it is new.
+  BigDecimal&   getRegister (int    varId
+        )
+      {
+        if  (varId >= (int)registerVect_.size())
+          registerVect_.resize(varId + 1);
+
+        return(registerVect_[varId]);
+      }
+
+  //  PURPOSE:  To write 'number' to 'out_' the way 'dc' prints it.  No
+  //  return value.
+  void    print (const BigDecimal&  number
+        )
+      {
+        digits_.clear();
+        number.appendDigits(digits_);
+        writeNumber(out_,number.getIsNegative(),digits_,number.getScale());
+      }
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' with empty registers and stack, to
+  //  print to 'newOut'.
+  DcMachine   (std::ostream&  newOut
+        )
+      throw() :
+      stackSize_(0),
+      precision_(0),
+      out_(newOut)
+      { }
+
+  //  V.  Accessors:
+
+  //  VI.  Mutators:
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To write to 'out' the way 'dc' prints it the number whose
+  //  magnitude has the decimal 'digits' ("" for 0), negated if 'isNegative',
+  //  with 'scale' of them after the point: no leading zero before the point,
+  //  all 'scale' digits after it, lines continued with a backslash.  No
+  //  return value.
+  static
+  void    writeNumber (std::ostream&  out,
+         bool     isNegative,
+         const std::string& digits,
+         int      scale
+        )
+      {
+        std::string text;
+        int   numDigits = (int)digits.length();
+
+        if  (numDigits == 0)
+          text  = "0";
+        else
+        {
+          if  (isNegative)
+            text  += '-';
+
+          if  (numDigits > scale)
+            text.append(digits,0,numDigits - scale);
+
+          if  (scale > 0)
+          {
+            text  += '.';
+
+            if  (scale > numDigits)
+              text.append(scale - numDigits,'0');
+
+            text.append(digits,(numDigits > scale) ? numDigits - scale : 0,
+            std::string::npos
+           );
+          }
+        }
+
+        for  (size_t i = 0;  i < text.length();  i++)
+        {
+          if  ( (i > 0) && (i % (LINE_LENGTH-1) == 0) )
+            out << "\\\n";
+
+          out << text[i];
+        }
+
+        out << '\n';
+      }
+
+  //  PURPOSE:  To run the instructions held in 'dcCode'.  No return value.
+  void    run (const DcCode&  dcCode
+        )
+      throw(const char*)
+      {
+        for  (size_t i = 0;  i < dcCode.getNumInstructions();  i++)
+        {
+          const DcInstruction&  instr = dcCode.getInstruction(i);
+
+          switch  (instr.op_)
+          {
+          case PUSH_NUMBER_DC_OP :
+            push().setText(dcCode.getNumberText(instr),
+               instr.value_.literal_.length_
+              );
+            break;
+
+          case LOAD_DC_OP :
+            push()  = getRegister(instr.value_.varId_);
+            break;
+
+          case STORE_DC_OP :
+            getRegister(instr.value_.varId_).swap(peek(0));
+            stackSize_--;
+            break;
+
+          case DISCARD_DC_OP :
+            discarded_.swap(peek(0));
+            stackSize_--;
+            break;
+
+          case DUPLICATE_DC_OP :
+            {
+              peek(0);
+
+              BigDecimal& top = push();
+
+              top = stack_[stackSize_ - 2];
+            }
+            break;
+
+          case ADD_DC_OP :
+          case SUBTRACT_DC_OP :
+            peek(1).add(peek(0),instr.op_ == SUBTRACT_DC_OP);
+            stackSize_--;
+            break;
+
+          case PRINT_DC_OP :
+            print(peek(0));
+            break;
+
+          case PRECISION_DC_OP :
+            precision_  = instr.value_.integer_;
+            break;
+
+          case NO_DC_OP :
+            break;
+          }
+        }
+      }
+
+};
+
+
+/*  PURPOSE:  To run the statements of an ac program as x86-64 machine code
+ *  made for them on the fly.  Each value is kept the way 'dc' keeps it, as
+ *  'units' / 10^scale, but with 'units' in a 64-bit register: an ac program
+ *  has no branches, so the scale of every value is known when its code is
+ *  made, and '+' and '-' become integer adds after multiplying by constant
+ *  powers of 10.  Code that would overflow 64 bits stops with an error
+ *  rather than give a wrong answer.  Conversions only change 'k', so they
+ *  make no code.
+ */
+class NativeMachine
+{
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To name the x86-64 registers that are used.  'R12' to 'R15'
+  //  hold the most used variables of a batch: they survive calls.
+  enum    {
+        RAX = 0,
+        RCX = 1,
+        RDX = 2,
+        RBX = 3,
+        RSI = 6,
+        RDI = 7,
+        R12 = 12,
+        NUM_VAR_REGISTERS = 4
+      };
+
+  //  PURPOSE:  To tell how many decimal digits 'units' may be multiplied by
+  //  at once.
+  static
+  const
+  int     MAX_POWER_OF_10 = 18;
+
+  //  I.  Member vars:
+  //  PURPOSE:  To tell how many variables there are.
+  const SymbolTable&  symbolTable_;
+
+  //  PURPOSE:  To hold the 'units' of each variable between batches, indexed
+  //  by variable id.
+  std::vector<long long>
+      unitsVect_;
+
+  //  PURPOSE:  To hold the scale of each variable after the code made so
+  //  far has run.
+  std::vector<int>
+      scaleVect_;
+
+  //  PURPOSE:  To hold the register that holds each variable in the code
+  //  for the current batch, or -1 if it is kept in 'unitsVect_'.
+  std::vector<int>
+      registerVect_;
+
+  //  PURPOSE:  To hold the ids of the variables that are given a register in
+  //  the code for the current batch.
+  std::vector<int>
+      registeredVarVect_;
+
+  //  PURPOSE:  To hold how often each variable is used by the current batch.
+  std::vector<int>
+      numUsesVect_;
+
+  //  PURPOSE:  To hold the code for the current batch as it is made.
+  std::vector<unsigned char>
+      codeVect_;
+
+  //  PURPOSE:  To hold where in 'codeVect_' each jump to the overflow exit
+  //  keeps its 32-bit displacement.
+  std::vector<size_t>
+      overflowJumpVect_;
+
+  //  PURPOSE:  To point to the executable memory the code is copied to, and
+  //  to tell its length.
+  unsigned char*  bufferPtr_;
+  size_t    bufferLength_;
+
+  //  PURPOSE:  To hold the nodes of the statements run.
+  const SyntaxTree& tree_;
+
+  //  PURPOSE:  To hold the text of the literals the statements refer to.
+  const LiteralPool&  literalPool_;
+
+  //  PURPOSE:  To hold where 'p' writes.
+  std::ostream&   out_;
+
+  //  PURPOSE:  To hold the digits of the number being printed.
+  std::string   digits_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No default constructor:
+  NativeMachine   ();
+
+  //  No copy constructor:
+  NativeMachine   (const NativeMachine&
+        );
+
+  //  No copy assignment op:
+  NativeMachine&  operator=
+      (const NativeMachine&
+        );
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To return 10^'power'.
+  static
+  long long   powerOf10 (int    power
+        )
+      throw()
+      {
+        long long toReturn  = 1;
+
+        while  (power-- > 0)
+          toReturn  *= 10;
+
+        return(toReturn);
+      }
+
+  //  PURPOSE:  To return 'node' without the conversions wrapped around it.
+  NodeInd   getValue  (NodeInd  node
+        )
+        const
+      throw()
+      {
+        while  ( (node != NO_NODE)  &&
+           (tree_.getSymbol(node) == TYPE_CONVERT_SYMBOL)
+         )
+          node  = tree_.getLhs(node);
+
+        return(node);
+      }
+
+  //  PURPOSE:  To return the scale of the value at 'value' (a variable or a
+  //  literal) when the code made so far has run.
+  int     getScale  (NodeInd  value
+        )
+        const
+      throw()
+      {
+        if  (tree_.getSymbol(value) == ID_SYMBOL)
+          return(scaleVect_[tree_.getVarId(value)]);
+
+        const char* textPtr = literalPool_.getText(tree_.getLiteral(value));
+        size_t    length  = tree_.getLiteralLength(value);
+        const char* pointPtr  = (const char*)memchr(textPtr,'.',length);
+
+        return( (pointPtr == NULL)
+          ? 0
+          : (int)(textPtr + length - pointPtr - 1)
+        );
+      }
+
+  //  PURPOSE:  To return the units of the literal at 'value' (led by '_' if
+  //  negative) when it is given scale 'scale' (not less than its own).
+  long long   getUnits  (NodeInd  value,
+         int      scale
+        )
+        const
+      throw(const char*)
+      {
+        const char* textPtr = literalPool_.getText(tree_.getLiteral(value));
+        bool    isNegative  = (textPtr[0] == '_');
+        long long units   = 0;
+
+        for  (size_t i = isNegative ? 1 : 0;
+              i < tree_.getLiteralLength(value);
+              i++
+             )
+          if  ( (textPtr[i] != '.')  &&
+          ( __builtin_mul_overflow(units,10LL,&units)  ||
+            __builtin_add_overflow(units,textPtr[i] - '0',&units)
+          )
+        )
+            throw "Number too big to run natively";
+
+        for  (int i = getScale(value);  i < scale;  i++)
+          if  (__builtin_mul_overflow(units,10LL,&units))
+            throw "Number too big to run natively";
+
+        return(isNegative ? -units : units);
+      }
+
+  //  PURPOSE:  To append 'byte' to the code.  No return value.
+  void    emit  (unsigned char  byte
+        )
+      { codeVect_.push_back(byte); }
+
+  //  PURPOSE:  To append the 'numBytes' low bytes of 'value' to the code,
+  //  least significant first.  No return value.
+  void    emitBytes (unsigned long long value,
+         int      numBytes
+        )
+      {
+        for  (int i = 0;  i < numBytes;  i++)
+          emit( (unsigned char)(value >> (8*i)) );
+      }
+
+  //  PURPOSE:  To append a 64-bit instruction 'opcode' whose register operand
+  //  is 'reg' and whose other operand is register 'rm'.  No return value.
+  void    emitRegReg  (unsigned char  opcode,
+         int      reg,
+         int      rm
+        )
+      {
+        emit(0x48 | ((reg >= 8) ? 4 : 0) | ((rm >= 8) ? 1 : 0));
+        emit(opcode);
+        emit(0xC0 | ((reg & 7) << 3) | (rm & 7));
+      }
+
+  //  PURPOSE:  To append a 64-bit instruction 'opcode' whose register operand
+  //  is 'reg' and whose other operand is the slot of variable 'varInd' in
+  //  'unitsVect_' (whose data 'RBX' points to).  No return value.
+  void    emitRegMem  (unsigned char  opcode,
+         int      reg,
+         int      varInd
+        )
+      {
+        emit(0x48 | ((reg >= 8) ? 4 : 0));
+        emit(opcode);
+        emit(0x80 | ((reg & 7) << 3) | RBX);
+        emitBytes(8 * varInd,4);
+      }
+
+  //  PURPOSE:  To append code that sets register 'reg' to 'value'.  No
+  //  return value.
+  void    emitMoveImmediate
+      (int    reg,
+       long long  value
+      )
+      {
+        emit(0x48 | ((reg >= 8) ? 1 : 0));
+        emit(0xB8 + (reg & 7));
+        emitBytes(value,8);
+      }
+
+  //  PURPOSE:  To append a jump, taken on signed overflow, to the overflow
+  //  exit.  No return value.
+  void    emitJumpOnOverflow
+      ()
+      {
+        emit(0x0F);
+        emit(0x80);
+        overflowJumpVect_.push_back(codeVect_.size());
+        emitBytes(0,4);
+      }
+
+  //  PURPOSE:  To append code that multiplies register 'reg' by 10^'power'.
+  //  No return value.
+  void    emitScale (int    reg,
+         int    power
+        )
+      throw(const char*)
+      {
+        if  (power == 0)
+          return;
+
+        if  (power > MAX_POWER_OF_10)
+          throw "Number too big to run natively";
+
+        if  (power <= 9)
+        {
+          emitRegReg(0x69,reg,reg);         // imul reg,reg,imm32
+          emitBytes(powerOf10(power),4);
+        }
+        else
+        {
+          emitMoveImmediate(RDX,powerOf10(power));
+          emit(0x48 | ((reg >= 8) ? 4 : 0));        // imul reg,rdx
+          emit(0x0F);
+          emit(0xAF);
+          emit(0xC0 | ((reg & 7) << 3) | RDX);
+        }
+
+        emitJumpOnOverflow();
+      }
+
+  //  PURPOSE:  To append code that sets register 'reg' to the units of the
+  //  value at 'value' given scale 'scale'.  No return value.
+  void    emitLoad  (int    reg,
+         NodeInd  value,
+         int    scale
+        )
+      throw(const char*)
+      {
+        if  (tree_.getSymbol(value) != ID_SYMBOL)
+        {
+          emitMoveImmediate(reg,getUnits(value,scale));
+          return;
+        }
+
+        int varInd  = tree_.getVarId(value);
+
+        if  (registerVect_[varInd] >= 0)
+          emitRegReg(0x89,registerVect_[varInd],reg); // mov reg,varReg
+        else
+          emitRegMem(0x8B,reg,varInd);        // mov reg,[rbx+disp]
+
+        emitScale(reg,scale - scaleVect_[varInd]);
+      }
+
+  //  PURPOSE:  To append the code for the statement at 'statement'.  No
+  //  return value.
+  void    emitStatement
+      (NodeInd  statement
+      )
+      throw(const char*)
+      {
+        if  (tree_.getSymbol(statement) == PRINT_SYMBOL)
+        {
+          NodeInd value = getValue(tree_.getLhs(statement));
+          int   scale = getScale(value);
+
+          emitLoad(RSI,value,scale);
+          emitMoveImmediate(RDI,(long long)this);
+          emit(0xB8 + RDX);             // mov edx,imm32
+          emitBytes(scale,4);
+          emitMoveImmediate(RAX,(long long)&printHelper);
+          emit(0xFF);               // call rax
+          emit(0xD0);
+          return;
+        }
+
+        //  I.  Find the scale of the result, the largest of its values:
+        NodeInd lhs = getValue(tree_.getAssignedLhs(statement));
+        int   scale = getScale(lhs);
+        NodeInd node;
+
+        for  (node = getValue(tree_.getAssignedRhs(statement));
+              node != NO_NODE;
+              node = getValue(tree_.getRhs(node))
+             )
+        {
+          int termScale = getScale(getValue(tree_.getLhs(node)));
+
+          if  (scale < termScale)
+            scale = termScale;
+        }
+
+        //  II.  Sum the values in 'RAX':
+        emitLoad(RAX,lhs,scale);
+
+        for  (node = getValue(tree_.getAssignedRhs(statement));
+              node != NO_NODE;
+              node = getValue(tree_.getRhs(node))
+             )
+        {
+          emitLoad(RCX,getValue(tree_.getLhs(node)),scale);
+          emitRegReg( (tree_.getSymbol(node) == SUBTRACT_SYMBOL) ? 0x29 : 0x01,
+                RCX,
+                RAX
+              );                // add/sub rax,rcx
+          emitJumpOnOverflow();
+        }
+
+        //  III.  Store it:
+        int varInd  = tree_.getVarId(tree_.getAssignedVar(statement));
+
+        if  (registerVect_[varInd] >= 0)
+          emitRegReg(0x89,RAX,registerVect_[varInd]); // mov varReg,rax
+        else
+          emitRegMem(0x89,RAX,varInd);        // mov [rbx+disp],rax
+
+        scaleVect_[varInd]  = scale;
+      }
+
+  //  PURPOSE:  To give 'R12' to 'R15' to the variables used most often by
+  //  the statements in 'statementList', and to note them in 'registerVect_'
+  //  and 'registeredVarVect_'.  No return value.
+  void    assignRegisters
+      (const StatementList& statementList
+      )
+      {
+        for  (size_t i = 0;  i < registeredVarVect_.size();  i++)
+          registerVect_[registeredVarVect_[i]]  = -1;
+
+        registeredVarVect_.clear();
+        numUsesVect_.assign(symbolTable_.getNumVars(),0);
+
+        for  (size_t i = 0;  i < statementList.size();  i++)
+        {
+          NodeInd statement = statementList[i];
+          NodeInd value;
+
+          if  (tree_.getSymbol(statement) == PRINT_SYMBOL)
+          {
+            value = getValue(tree_.getLhs(statement));
+
+            if  (tree_.getSymbol(value) == ID_SYMBOL)
+              numUsesVect_[tree_.getVarId(value)]++;
+
+            continue;
+          }
+
+          numUsesVect_[tree_.getVarId(tree_.getAssignedVar(statement))]++;
+          value = getValue(tree_.getAssignedLhs(statement));
+
+          for  (NodeInd node = getValue(tree_.getAssignedRhs(statement));
+                ;
+                node = getValue(tree_.getRhs(node))
+               )
+          {
+            if  (tree_.getSymbol(value) == ID_SYMBOL)
+              numUsesVect_[tree_.getVarId(value)]++;
+
+            if  (node == NO_NODE)
+              break;
+
+            value = getValue(tree_.getLhs(node));
+          }
+        }
+
+        for  (int reg = R12;  reg < R12 + NUM_VAR_REGISTERS;  reg++)
+        {
+          int mostInd = 0;
+
+          for  (int i = 1;  i < (int)numUsesVect_.size();  i++)
+            if  (numUsesVect_[i] > numUsesVect_[mostInd])
+              mostInd = i;
+
+          if  ( numUsesVect_.empty()  ||  (numUsesVect_[mostInd] == 0) )
+            break;
+
+          registerVect_[mostInd]  = reg;
+          registeredVarVect_.push_back(mostInd);
+          numUsesVect_[mostInd]   = 0;
+        }
+      }
+
+  //  PURPOSE:  To write to 'machinePtr->out_' the value of 'units' /
+  //  10^'scale' the way 'dc' prints it.  Called from the made code.  No
+  //  return value.
+  static
+  void    printHelper (NativeMachine* machinePtr,
+         long long  units,
+         int    scale
+        )
+      throw()
+      {
+        char  text[24];
+
+        machinePtr->digits_.clear();
+
+        if  (units != 0)
+        {
+          snprintf(text,sizeof(text),"%llu",
+             (units < 0) ? -(unsigned long long)units : units
+            );
+          machinePtr->digits_ = text;
+        }
+
+        DcMachine::writeNumber(machinePtr->out_,units < 0,
+             machinePtr->digits_,scale
+            );
+      }
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' with all variables 0, to run statements
+  //  whose variables are named in 'newSymbolTable', whose nodes are in
+  //  'newTree' and whose literals are in 'newLiteralPool', and to print to
+  //  'newOut'.
+  NativeMachine   (const SymbolTable& newSymbolTable,
+         const SyntaxTree&  newTree,
+         const LiteralPool& newLiteralPool,
+         std::ostream&    newOut
+        )
+      throw() :
+      symbolTable_(newSymbolTable),
+      bufferPtr_(NULL),
+      bufferLength_(0),
+      tree_(newTree),
+      literalPool_(newLiteralPool),
+      out_(newOut)
+      { }
+
+  //  PURPOSE:  To release resources.  No parameters.
+  ~NativeMachine  ()
+      throw()
+      {
+        if  (bufferPtr_ != NULL)
+          munmap(bufferPtr_,bufferLength_);
+      }
+
+  //  V.  Accessors:
+
+  //  VI.  Mutators:
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To make and run the code for the (checked) statements in
+  //  'statementList'.  No return value.
+  void    run (const StatementList& statementList
+        )
+      throw(const char*)
+      {
+        size_t  numVars = symbolTable_.getNumVars();
+
+        codeVect_.clear();
+        overflowJumpVect_.clear();
+        unitsVect_.resize(numVars,0);
+        scaleVect_.resize(numVars,0);
+        registerVect_.resize(numVars,-1);
+        assignRegisters(statementList);
+
+        //  I.  Prologue: save registers, load the variables kept in them:
+        emit(0x53);               // push rbx
+
+        for  (int reg = R12;  reg < R12 + NUM_VAR_REGISTERS;  reg++)
+        {
+          emit(0x41);             // push reg
+          emit(0x50 + (reg & 7));
+        }
+
+        emitMoveImmediate(RBX,(long long)unitsVect_.data());
+
+        for  (size_t i = 0;  i < registeredVarVect_.size();  i++)
+          emitRegMem(0x8B,registerVect_[registeredVarVect_[i]],
+               registeredVarVect_[i]
+              );
+
+        //  II.  Body:
+        for  (size_t i = 0;  i < statementList.size();  i++)
+          emitStatement(statementList[i]);
+
+        //  III.  Epilogue: return 0 (1 if overflowed) after storing the
+        //  variables kept in registers and restoring the registers saved:
+        emit(0x31);               // xor eax,eax
+        emit(0xC0);
+
+        size_t  exitInd = codeVect_.size();
+
+        for  (size_t i = 0;  i < registeredVarVect_.size();  i++)
+          emitRegMem(0x89,registerVect_[registeredVarVect_[i]],
+               registeredVarVect_[i]
+              );
+
+        for  (int reg = R12 + NUM_VAR_REGISTERS - 1;  reg >= R12;  reg--)
+        {
+          emit(0x41);             // pop reg
+          emit(0x58 + (reg & 7));
+        }
+
+        emit(0x5B);               // pop rbx
+        emit(0xC3);               // ret
+
+        size_t  overflowInd = codeVect_.size();
+
+        emit(0xB8);               // mov eax,1
+        emitBytes(1,4);
+        emit(0xE9);               // jmp exit
+        emitBytes(exitInd - (codeVect_.size() + 4),4);
+
+        for  (size_t i = 0;  i < overflowJumpVect_.size();  i++)
+        {
+          size_t  jumpInd = overflowJumpVect_[i];
+          size_t  displacement  = overflowInd - (jumpInd + 4);
+
+          for  (int j = 0;  j < 4;  j++)
+            codeVect_[jumpInd + j]  = (unsigned char)(displacement >> (8*j));
+        }
+
+        //  IV.  Copy the code to executable memory and run it:
+        if  (bufferLength_ < codeVect_.size())
+        {
+          if  (bufferPtr_ != NULL)
+            munmap(bufferPtr_,bufferLength_);
+
+          bufferLength_ = (codeVect_.size() + 0xFFFF) & ~(size_t)0xFFFF;
+          bufferPtr_  = (unsigned char*)mmap(NULL,bufferLength_,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS,
+                     -1,0
+                    );
+
+          if  (bufferPtr_ == (unsigned char*)MAP_FAILED)
+          {
+            bufferPtr_  = NULL;
+            bufferLength_ = 0;
+            throw "Cannot map memory for native code";
+          }
+        }
+
+        memcpy(bufferPtr_,&codeVect_[0],codeVect_.size());
+
+        if  (mprotect(bufferPtr_,bufferLength_,PROT_READ | PROT_EXEC) != 0)
+          throw "Cannot make native code executable";
+
+        int status  = ((int (*)())bufferPtr_)();
+
+        mprotect(bufferPtr_,bufferLength_,PROT_READ | PROT_WRITE);
+
+        if  (status != 0)
+          throw "Number too big to run natively";
+      }
+
+};
+
+
+//  PURPOSE:  To declare the interface of a set of jobs, numbered from 0,
+//  that 'WorkStealingPool' may run on any of its threads.
+class JobRunner
+{
+public :
+  //  PURPOSE:  To release resources.  No parameters.
+  virtual
+  ~JobRunner    ()
+      { }
+
+  //  PURPOSE:  To run job 'jobInd' on the thread of worker 'workerInd'.  Must
+  //  not throw.  No return value.
+  virtual
+  void    runJob  (size_t   jobInd,
+         int    workerInd
+        )
+      throw()
+      = 0;
+};
+
+
+//  PURPOSE:  To run a set of independent jobs on a fixed number of threads.
+//  Each worker starts with its own contiguous share of the jobs in its own
+//  queue, and takes them from the back; a worker whose queue is empty steals
+//  from the front of the others', so the load stays balanced when some jobs
+//  take much longer than others, while the workers seldom touch the same
+//  lock.
+class WorkStealingPool
+{
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To hold the jobs of one worker and the lock that guards them.
+  struct  WorkerQueue
+  {
+    std::mutex    mutex_;
+    std::deque<size_t>
+        jobDeque_;
+  };
+
+  //  I.  Member vars:
+  //  PURPOSE:  To hold how many workers (the calling thread included) run
+  //  the jobs.
+  int     numWorkers_;
+
+  //  PURPOSE:  To hold the queue of each worker.
+  std::vector<WorkerQueue>
+      queueVect_;
+
+  //  PURPOSE:  To count the jobs taken from the queue of another worker.
+  std::atomic<size_t>
+      numSteals_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No default constructor:
+  WorkStealingPool  ();
+
+  //  No copy constructor:
+  WorkStealingPool  (const WorkStealingPool&
+        );
+
+  //  No copy assignment op:
+  WorkStealingPool& operator=
+      (const WorkStealingPool&
+        );
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To take the next job for worker 'workerInd' into '*jobIndPtr':
+  //  from the back of its own queue if it has one, or else from the front
+  //  of another's.  Returns 'true' if a job was taken, or 'false' if none
+  //  are left.
+  bool    takeJob (int    workerInd,
+         size_t*  jobIndPtr
+        )
+      {
+        for  (int i = 0;  i < numWorkers_;  i++)
+        {
+          WorkerQueue&  queue = queueVect_[(workerInd + i) % numWorkers_];
+          std::lock_guard<std::mutex>
+              guard(queue.mutex_);
+
+          if  (queue.jobDeque_.empty())
+            continue;
+
+          if  (i == 0)
+          {
+            *jobIndPtr  = queue.jobDeque_.back();
+            queue.jobDeque_.pop_back();
+          }
+          else
+          {
+            *jobIndPtr  = queue.jobDeque_.front();
+            queue.jobDeque_.pop_front();
+            numSteals_++;
+          }
+
+          return(true);
+        }
+
+        return(false);
+      }
+
+  //  PURPOSE:  To run jobs with 'jobRunner' as worker 'workerInd' until none
+  //  are left.  No return value.
+  void    work  (JobRunner& jobRunner,
+         int    workerInd
+        )
+      {
+        size_t  jobInd;
+
+        while  ( takeJob(workerInd,&jobInd) )
+          jobRunner.runJob(jobInd,workerInd);
+      }
+
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to run jobs on 'newNumWorkers' threads
+  //  (at least 1).
+  WorkStealingPool  (int    newNumWorkers
+        ) :
+      numWorkers_( (newNumWorkers < 1) ? 1 : newNumWorkers ),
+      queueVect_(numWorkers_),
+      numSteals_(0)
+      { }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return how many workers run the jobs.
+  int     getNumWorkers
+      ()
+        const
+      throw()
+      { return(numWorkers_); }
+
+  //  PURPOSE:  To return how many jobs were stolen by the last 'run()'.
+  size_t    getNumSteals
+      ()
+        const
+      throw()
+      { return(numSteals_); }
+
+  //  VI.  Mutators:
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To run jobs 0 to 'numJobs'-1 with 'jobRunner', the calling
+  //  thread being worker 0, and to return when all are done.  No return
+  //  value.
+  void    run (size_t   numJobs,
+         JobRunner& jobRunner
+        )
+      {
+        std::vector<std::thread>
+            threadVect;
+
+        numSteals_  = 0;
+
+        for  (int w = 0;  w < numWorkers_;  w++)
+          for  (size_t jobInd = numJobs * w / numWorkers_;
+                jobInd < numJobs * (w + 1) / numWorkers_;
+                jobInd++
+               )
+            queueVect_[w].jobDeque_.push_back(jobInd);
+
+        for  (int w = 1;  w < numWorkers_;  w++)
+          threadVect.push_back
+              (std::thread(&WorkStealingPool::work,this,
+                   std::ref(jobRunner),w
+                  )
+              );
+
+        work(jobRunner,0);
+
+        for  (size_t i = 0;  i < threadVect.size();  i++)
+          threadVect[i].join();
+      }
+
+};
+
+
+
+/*---*
+ *---*    Translation state:
+ *---*/
+
+//  PURPOSE:  To hold everything one translation works on, so that several
+//  translations may be carried out at once (each on its own thread).
+struct  TranslationState
+{
+  //  PURPOSE:  To holds the types of the symbols (well, variables) that occur
+  //  in the parsed program.
+  SymbolTable   symbolTable_;
+
+  //  PURPOSE:  To hold the syntax tree of the program being translated.
+  SyntaxTree    tree_;
+
+  //  PURPOSE:  To hold the text of the numeric literals of the program being
+  //  translated.
+  LiteralPool   literalPool_;
+};
+
+
+
+/*---*
+ *---*    Functions used directly to parse:
+ *---*/
+
+//  PURPOSE:  To ensure that a 'Symbol' instance of type 'expectedSymbol'
+//  occurs next in the token stream 'tokenStream'.  Returns pointer to
+//  symbol after successfully checked.
+Symbol  expect    (TokenStream& tokenStream,
+       symbol_t expectedSymbol
+      )
+      throw(const char*)
+{
+  Symbol  symbol  = tokenStream.advance();
+
+  if  (symbol.symbol_ != expectedSymbol)
+    throw "Unexpected symbol";
+
+  return(symbol);
+}
+
+
+//  PURPOSE:  To parse a single variable declaration from 'tokenStream'.
+//  Returns 'NO_NODE' as no nodes need to be created to declare a variable.
+NodeInd parseDeclare  (TranslationState& state,
+       TokenStream& tokenStream
+      )
+{
+  Symbol  var;
+  dcType_t  varType;
+
+  if  (tokenStream.peek() == FLOAT_DECLARE_SYMBOL)
+  {
+    expect(tokenStream,FLOAT_DECLARE_SYMBOL);
+    var   = expect(tokenStream,ID_SYMBOL);
+    varType = FLOAT_POINT_DC_TYPE;
+  }
+  else
+  if  (tokenStream.peek() == INT_DECLARE_SYMBOL)
+  {
+    expect(tokenStream,INT_DECLARE_SYMBOL);
+    var   = expect(tokenStream,ID_SYMBOL);
+    varType = INTEGER_DC_TYPE;
+  }
+  else
+    throw "expected float or int declaration";
+
+  state.symbolTable_.enter(varType,var.value_.varId_);
+
+  return(NO_NODE);
+}
+
+
+//  PURPOSE:  To parse zero or more variable declarations from 'tokenStream'.
+//  Returns 'NO_NODE' as no nodes need to be created to declare a variable.
+//  Loops rather than recurses so that stack use does not grow with the
+//  number of declarations.
+NodeInd parseDeclares (TranslationState& state,
+       TokenStream& tokenStream
+      )
+{
+  while  ( (tokenStream.peek() == FLOAT_DECLARE_SYMBOL) ||
+        (tokenStream.peek() == INT_DECLARE_SYMBOL)
+      )
+    parseDeclare(state,tokenStream);
+
+  if  ( (tokenStream.peek() == ID_SYMBOL) ||
+  (tokenStream.peek() == PRINT_SYMBOL)  ||
+  (tokenStream.peek() == END_OF_FILE_SYMBOL)
+      )
+  {
+    //  lambda production
+  }
+  else
+    throw "expected floatdcl, intdcl, id, print, or eof";
+
+  return(NO_NODE);
+}
+
+
+//  PURPOSE:  To parse and return the node that represents a value from
+//  'tokenStream'.
+NodeInd parseValue  (TranslationState& state,
+       TokenStream& tokenStream
+      )
+{
+  NodeInd node;
+
+  if  (tokenStream.peek() == ID_SYMBOL)
+    node  = state.tree_.newNode(expect(tokenStream,ID_SYMBOL));
+  else
+  if  (tokenStream.peek() == INT_SYMBOL)
+    node  = state.tree_.newNode(expect(tokenStream,INT_SYMBOL));
+  else
+  if  (tokenStream.peek() == FLOAT_SYMBOL)
+    node  = state.tree_.newNode(expect(tokenStream,FLOAT_SYMBOL));
+  else
+    throw "expected id, inum, or fnum";
+
+  return(node);
+}
+
+
+//  PURPOSE:  To parse and return the first node of the chain of '+' and '-'
+//  nodes that represents an expression from 'tokenStream', or 'NO_NODE' if
+//  it is empty.  Loops rather than recurses, linking each node to the one
+//  before it, so that stack use does not grow with the length of the chain.
+NodeInd parseExpression (TranslationState& state,
+       TokenStream& tokenStream
+      )
+{
+  NodeInd first = NO_NODE;
+  NodeInd last  = NO_NODE;
+
+  while  ( (tokenStream.peek() == ADD_SYMBOL) ||
+        (tokenStream.peek() == SUBTRACT_SYMBOL)
+      )
+  {
+    NodeInd node  = state.tree_.newNode(tokenStream.advance());
+
+    state.tree_.setLhs(node,parseValue(state,tokenStream));
+
+    if  (last == NO_NODE)
+      first = node;
+    else
+      state.tree_.setRhs(last,node);
+
+    last  = node;
+  }
+
+  if  ( (tokenStream.peek() == ID_SYMBOL) ||
+  (tokenStream.peek() == PRINT_SYMBOL)  ||
+  (tokenStream.peek() == END_OF_FILE_SYMBOL)
+      )
+  {
+    // Do nothing for lambda-production
+  }
+  else
+    throw "expected plus, minus, id, print, or eof";
+
+  return(first);
+}
+
+
+//  PURPOSE:  To parse and return the node that represents a statement from
+//  'tokenStream'.  The nodes of a statement are made in the order they are
+//  written, so they lie together in the 'SyntaxTree' of 'state'.
+NodeInd parseStatement  (TranslationState& state,
+       TokenStream& tokenStream
+      )
+{
+  SyntaxTree& tree  = state.tree_;
+  NodeInd node;
+
+  if  (tokenStream.peek() == ID_SYMBOL)
+  {
+    NodeInd var = tree.newNode(expect(tokenStream,ID_SYMBOL));
+
+    node  = tree.newNode(expect(tokenStream,ASSIGN_SYMBOL));
+    tree.setAssignedVar(node,var);
+    tree.setAssignedLhs(node,parseValue(state,tokenStream));
+    tree.setAssignedRhs(node,parseExpression(state,tokenStream));
+  }
+  else
+  if  (tokenStream.peek() == PRINT_SYMBOL)
+  {
+    node  = tree.newNode(expect(tokenStream,PRINT_SYMBOL));
+    tree.setLhs(node,tree.newNode(expect(tokenStream,ID_SYMBOL)));
+  }
+  else
+    throw "expected id or print";
+
+  return(node);
+}
+
+
+//  PURPOSE:  To parse up to 'maxNumStatements' statements from 'tokenStream'
+//  and append them, in order, to 'statementList'.  Loops rather than
+//  recurses so that stack use does not grow with the length of the program.
+//  No return value.
+void  parseStatements (TranslationState& state,
+       TokenStream& tokenStream,
+       StatementList& statementList,
+       size_t   maxNumStatements
+      )
+{
+  size_t  numParsed = 0;
+
+  while  ( (numParsed < maxNumStatements)  &&
+     (tokenStream.peek() == ID_SYMBOL || tokenStream.peek() == PRINT_SYMBOL)
+   )
+  {
+    statementList.push_back(parseStatement(state,tokenStream));
+    numParsed++;
+  }
+
+  if  ( (numParsed < maxNumStatements)  &&
+     (tokenStream.peek() != END_OF_FILE_SYMBOL)
+   )
+    throw "expected id, print, or eof";
+}
+
+
+
+/*---*
+ *---*    Functions used to process the parse tree after parsing:
+ *---*/
+
+//  PURPOSE:  To return the more general type among 'first' or 'second'.
+dcType_t
+  generalize  (dcType_t first,
+       dcType_t second
+      )
+      throw()
+{
+  return( ( (first == FLOAT_POINT_DC_TYPE) || (second == FLOAT_POINT_DC_TYPE) )
+    ? FLOAT_POINT_DC_TYPE
+    : INTEGER_DC_TYPE
+  );
+}
+
+
+//  PURPOSE:  To return a node that casts node 'node' to type 'desiredType',
+//  if it is needed.  Just returns 'node' if not needed.  'node' must already
+//  have been typed by 'annotateTypes()'.
+NodeInd convert   (TranslationState& state,
+       NodeInd  node,
+       dcType_t desiredType
+      )
+      throw(const char*)
+{
+  dcType_t  givenType = state.tree_.getType(node);
+
+  if  ( (givenType    == FLOAT_POINT_DC_TYPE) &&
+  (desiredType      == INTEGER_DC_TYPE)
+      ){
+      snprintf(errorMessage,256,"Type mismatch %u",state.tree_.getSymbol(node));
+      throw errorMessage;
+      //throw "Type mismatch"
+  }
+    ;
+
+  NodeInd toReturn  = node;
+
+  if  ( (givenType    == INTEGER_DC_TYPE) &&
+  (desiredType      == FLOAT_POINT_DC_TYPE)
+      )
+    toReturn  = state.tree_.newNode(TYPE_CONVERT_SYMBOL,FLOAT_POINT_DC_TYPE,
+            node
+           );
+
+  return(toReturn);
+}
+
+
+//  PURPOSE:  To return 'true' if the value or expression at node 'node' may
+//  have digits after the point, or 'false' otherwise.  Walks a chain by
+//  looping down its rest, so stack use does not grow with its length.
+bool  mayHaveFraction (TranslationState& state,
+       NodeInd  node
+      )
+      throw()
+{
+  const SyntaxTree& tree  = state.tree_;
+
+  while  (node != NO_NODE)
+  {
+    switch  (tree.getSymbol(node))
+    {
+    case FLOAT_SYMBOL :
+      return(true);
+
+    case ID_SYMBOL :
+      return(state.symbolTable_.getMayHaveFraction(tree.getVarId(node)));
+
+    case ADD_SYMBOL :
+    case SUBTRACT_SYMBOL :
+      if  (mayHaveFraction(state,tree.getLhs(node)))
+        return(true);
+
+      node  = tree.getRhs(node);
+      break;
+
+    case TYPE_CONVERT_SYMBOL :
+      node  = tree.getLhs(node);
+      break;
+
+    default :
+      return(false);
+    }
+  }
+
+  return(false);
+}
+
+
+//  PURPOSE:  To type the nodes 'first' up to (but not including) 'end',
+//  which hold one statement just as it was parsed, and to add conversion
+//  nodes where the operands of '+' and '-' must be generalized.  As the
+//  nodes of a statement lie in the order written, this is a few linear
+//  scans: one forward over the values (so undeclared variables are reported
+//  in order), one backward over the chain (so each '+' and '-' comes after
+//  the rest of its chain), and then the statement itself.  The conversions
+//  made lie at or after 'end' and are already typed.  No return value.
+void  annotateTypes (TranslationState& state,
+       NodeInd  first,
+       NodeInd  end
+      )
+      throw(const char*)
+{
+  SyntaxTree& tree  = state.tree_;
+  NodeInd node;
+
+  //  I.  Type the values:
+  for  (node = first;  node < end;  node++)
+  {
+    switch  (tree.getSymbol(node))
+    {
+    case INT_SYMBOL :
+      tree.setType(node,INTEGER_DC_TYPE);
+      break;
+
+    case FLOAT_SYMBOL :
+      tree.setType(node,FLOAT_POINT_DC_TYPE);
+      break;
+
+    case ID_SYMBOL :
+      tree.setType(node,state.symbolTable_.lookUp(tree.getVarId(node)));
+      break;
+
+    default :
+      break;
+    }
+  }
+
+  //  II.  Type the chain from its end back:
+  for  (node = end;  node-- > first; )
+  {
+    symbol_t  symbol  = tree.getSymbol(node);
+
+    if  ( (symbol != ADD_SYMBOL)  &&  (symbol != SUBTRACT_SYMBOL) )
+      continue;
+
+    dcType_t  newType = generalize(tree.getType(tree.getLhs(node)),
+               tree.getType(tree.getRhs(node))
+              );
+
+    tree.setType(node,newType);
+    tree.setLhs(node,convert(state,tree.getLhs(node),newType));
+    tree.setRhs(node,convert(state,tree.getRhs(node),newType));
+  }
+
+  //  III.  Check the statement:
+  node  = first;
+
+  if  (tree.getSymbol(node) == ID_SYMBOL)
+    node++;
+
+  if  (tree.getSymbol(node) == ASSIGN_SYMBOL)
+  {
+    NodeInd var = tree.getAssignedVar(node);
+
+    tree.setAssignedLhs(node,convert(state,tree.getAssignedLhs(node),
+             tree.getType(var)
+            )
+           );
+
+    if  ( mayHaveFraction(state,tree.getAssignedLhs(node))  ||
+    mayHaveFraction(state,tree.getAssignedRhs(node))
+        )
+      state.symbolTable_.noteMayHaveFraction(tree.getVarId(var));
+  }
+}
+
+
+//  PURPOSE:  To return the first node of the statement at node 'statement',
+//  just as it was parsed.
+NodeInd getFirstNode  (const SyntaxTree&  tree,
+       NodeInd    statement
+      )
+      throw()
+{
+  return( (tree.getSymbol(statement) == ASSIGN_SYMBOL)
+    ? tree.getAssignedVar(statement)
+    : statement
+  );
+}
+
+
+//  PURPOSE:  To check the consistency (e.g. between expected and given type)
+//  of each statement in 'statementList', which must just have been parsed.
+//  The statements are checked in order, each over the run of nodes from its
+//  first one to the first one of the next.  No return value.
+void  checkConsistency(TranslationState& state,
+       StatementList& statementList
+      )
+      throw(const char*)
+{
+  const SyntaxTree& tree  = state.tree_;
+  NodeInd   end = tree.getEndInd();
+
+  for  (size_t i = 0;  i < statementList.size();  i++)
+    annotateTypes(state,
+      getFirstNode(tree,statementList[i]),
+      (i + 1 < statementList.size())
+      ? getFirstNode(tree,statementList[i + 1])
+      : end
+     );
+}
+
+
+//  PURPOSE:  To return 'node' without the conversion nodes wrapped around
+//  it.  (A conversion only changes 'k', which '+' and '-' ignore.)
+NodeInd unconverted (const SyntaxTree&  tree,
+       NodeInd    node
+      )
+      throw()
+{
+  while  ( (node != NO_NODE) && (tree.getSymbol(node) == TYPE_CONVERT_SYMBOL) )
+    node  = tree.getLhs(node);
+
+  return(node);
+}
+
+
+//  PURPOSE:  To return the number of nodes at node 'node' and below.
+size_t  countNodes  (const SyntaxTree&  tree,
+       NodeInd    node
+      )
+      throw()
+{
+  size_t  numNodes  = 0;
+
+  while  (node != NO_NODE)
+  {
+    numNodes++;
+
+    switch  (tree.getSymbol(node))
+    {
+    case ADD_SYMBOL :
+    case SUBTRACT_SYMBOL :
+      numNodes  += countNodes(tree,tree.getLhs(node));
+      node  = tree.getRhs(node);
+      break;
+
+    case PRINT_SYMBOL :
+    case TYPE_CONVERT_SYMBOL :
+      node  = tree.getLhs(node);
+      break;
+
+    case ASSIGN_SYMBOL :
+      numNodes  += countNodes(tree,tree.getAssignedVar(node))
+        + countNodes(tree,tree.getAssignedLhs(node));
+      node  = tree.getAssignedRhs(node);
+      break;
+
+    default :
+      node  = NO_NODE;
+      break;
+    }
+  }
+
+  return(numNodes);
+}
+
+
+//  PURPOSE:  To hold one value of an expression chain, and whether it is
+//  subtracted.
+struct  Term
+{
+  NodeInd   node_;
+  bool      isSubtracted_;
+};
+
+
+//  PURPOSE:  To hold the space 'foldConstants()' works in, kept from one
+//  statement to the next so that it need not be reallocated.
+struct  FoldScratch
+{
+  std::vector<Term>
+      termVect_;
+  std::vector<Term>
+      keptVect_;
+  BigDecimal    sum_;
+  BigDecimal    value_;
+};
+
+
+//  PURPOSE:  To simplify the expression assigned by node 'statement', which
+//  must have been typed by 'annotateTypes()'.  In 'dc' the chain is the sum
+//  of its (signed) values taken in any order, with the largest scale among
+//  them, so its literals are folded into one with the scale of the largest,
+//  and 'x - x' is cancelled when 'x' is an int variable that was never given
+//  a fraction (so its scale is 0).  Other variables are never cancelled:
+//  their scale is only known when the program runs.  Works in 'scratch'.
+//  Returns the number of nodes removed.
+size_t  foldConstants (TranslationState& state,
+       NodeInd  statement,
+       FoldScratch& scratch
+      )
+      throw(const char*)
+{
+  SyntaxTree& tree  = state.tree_;
+
+  if  ( (statement == NO_NODE)  ||
+  (tree.getSymbol(statement) != ASSIGN_SYMBOL)
+      )
+    return(0);
+
+  //  I.  Gather the values of the chain:
+  std::vector<Term>&
+      termVect  = scratch.termVect_;
+  std::vector<Term>&
+      keptVect  = scratch.keptVect_;
+  Term    term  = { tree.getAssignedLhs(statement), false };
+
+  termVect.clear();
+  keptVect.clear();
+  termVect.push_back(term);
+
+  for  (NodeInd node = unconverted(tree,tree.getAssignedRhs(statement));
+        node != NO_NODE;
+        node = unconverted(tree,tree.getRhs(node))
+       )
+  {
+    term.node_    = tree.getLhs(node);
+    term.isSubtracted_  = (tree.getSymbol(node) == SUBTRACT_SYMBOL);
+    termVect.push_back(term);
+  }
+
+  //  II.  Count the literals and cancel the int variables:
+  NodeInd constant  = NO_NODE;
+  int     numConstants  = 0;
+  int     numCancelled  = 0;
+
+  for  (size_t i = 0;  i < termVect.size();  i++)
+  {
+    NodeInd value = unconverted(tree,termVect[i].node_);
+
+    if  ( (tree.getSymbol(value) == INT_SYMBOL)  ||
+    (tree.getSymbol(value) == FLOAT_SYMBOL)
+        )
+    {
+      constant  = value;
+      numConstants++;
+      continue;
+    }
+
+    if  ( (tree.getSymbol(value) == ID_SYMBOL)  &&
+    !state.symbolTable_.getMayHaveFraction(tree.getVarId(value))
+        )
+    {
+      size_t  j;
+
+      for  (j = 0;  j < keptVect.size();  j++)
+      {
+        NodeInd kept  = unconverted(tree,keptVect[j].node_);
+
+        if  ( (keptVect[j].isSubtracted_ != termVect[i].isSubtracted_)  &&
+        (tree.getSymbol(kept) == ID_SYMBOL)       &&
+        (tree.getVarId(kept) == tree.getVarId(value))
+      )
+          break;
+      }
+
+      if  (j < keptVect.size())
+      {
+        keptVect.erase(keptVect.begin() + j);
+        numCancelled++;
+        continue;
+      }
+    }
+
+    keptVect.push_back(termVect[i]);
+  }
+
+  //  III.  Leave the statement alone if nothing would get simpler:
+  size_t  firstAddedInd = 0;
+
+  while  ( (firstAddedInd < keptVect.size())  &&
+     keptVect[firstAddedInd].isSubtracted_
+   )
+    firstAddedInd++;
+
+  if  ( (numConstants < 2)  &&  (numCancelled == 0) )
+  {
+    //  Only a lone int literal 0 added to a variable can go:
+    if  ( (constant == NO_NODE)  ||
+    (tree.getSymbol(constant) != INT_SYMBOL)  ||
+    (firstAddedInd == keptVect.size())
+        )
+      return(0);
+
+    const char* textPtr
+        = state.literalPool_.getText(tree.getLiteral(constant));
+
+    for  (size_t i = 0;  i < tree.getLiteralLength(constant);  i++)
+      if  (textPtr[i] != '0')
+        return(0);
+  }
+
+  BigDecimal& sum   = scratch.sum_;
+  BigDecimal& value   = scratch.value_;
+
+  sum.clear();
+
+  for  (size_t i = 0;  i < termVect.size();  i++)
+  {
+    NodeInd node  = unconverted(tree,termVect[i].node_);
+
+    if  ( (tree.getSymbol(node) == INT_SYMBOL)  ||
+    (tree.getSymbol(node) == FLOAT_SYMBOL)
+        )
+    {
+      value.setText(state.literalPool_.getText(tree.getLiteral(node)),
+        tree.getLiteralLength(node)
+         );
+      sum.add(value,termVect[i].isSubtracted_);
+    }
+  }
+
+  //  IV.  Rebuild the chain, led by the folded literal if it is kept.  The
+  //  value that would lead instead must convert to the variable's type, as
+  //  only the leading value is checked (e.g. "b = 0 + y", with 'b' an int
+  //  and 'y' a float, is fine, but "b = y" is not):
+  size_t  numBefore = countNodes(tree,statement);
+  dcType_t  varType   = tree.getType(tree.getAssignedVar(statement));
+  bool    canDropSum  = sum.isZero()  &&  (sum.getScale() == 0)  &&
+        (firstAddedInd < keptVect.size())  &&
+        !( (tree.getType(keptVect[firstAddedInd].node_)
+              == FLOAT_POINT_DC_TYPE
+           )  &&
+           (varType == INTEGER_DC_TYPE)
+         );
+  NodeInd lhs;
+
+  if  (canDropSum)
+  {
+    lhs = keptVect[firstAddedInd].node_;
+    keptVect.erase(keptVect.begin() + firstAddedInd);
+  }
+  else
+  {
+    std::string text;
+
+    sum.appendLiteral(text);
+    lhs = tree.newLiteral((sum.getScale() > 0) ? FLOAT_SYMBOL : INT_SYMBOL,
+        varType,
+        state.literalPool_.append(text)
+             );
+  }
+
+  NodeInd rest  = NO_NODE;
+
+  for  (size_t i = keptVect.size();  i-- > 0; )
+  {
+    dcType_t  newType = generalize(tree.getType(keptVect[i].node_),
+               tree.getType(rest)
+              );
+    NodeInd kept  = convert(state,keptVect[i].node_,newType);
+
+    rest  = tree.newNode(keptVect[i].isSubtracted_
+             ? SUBTRACT_SYMBOL
+             : ADD_SYMBOL,
+             newType,
+             kept,
+             convert(state,rest,newType)
+            );
+  }
+
+  tree.setAssignedLhs(statement,convert(state,lhs,varType));
+  tree.setAssignedRhs(statement,rest);
+
+  size_t  numAfter  = countNodes(tree,statement);
+
+  return( (numBefore > numAfter) ? numBefore - numAfter : 0 );
+}
+
+
+//  PURPOSE:  To hold what 'optimizeStatements()' knows of each variable,
+//  indexed by variable id.  It is kept from one batch to the next, and an
+//  entry only counts if it was set in the current batch (its stamp is
+//  'batch_'), so that a batch costs time for its own statements only, however
+//  many variables the program has.
+struct  OptimizeScratch
+{
+  FoldScratch   foldScratch_;
+
+  //  PURPOSE:  To number the batches.
+  unsigned int  batch_;
+
+  //  PURPOSE:  To hold the value known to be in each variable (a literal or
+  //  another variable), the batch it was noted in, and, for a variable, its
+  //  version then.
+  std::vector<NodeInd>
+      knownVect_;
+  std::vector<unsigned int>
+      knownBatchVect_;
+  std::vector<unsigned int>
+      knownVersionVect_;
+
+  //  PURPOSE:  To count the assignments to each variable, so that a copy of
+  //  a variable is forgotten just by the variable being assigned again.
+  std::vector<unsigned int>
+      versionVect_;
+
+  //  PURPOSE:  To tell if each variable is read before it is next assigned,
+  //  and the batch that was noted in.
+  std::vector<bool>
+      isLiveVect_;
+  std::vector<unsigned int>
+      liveBatchVect_;
+};
+
+
+//  PURPOSE:  To return the value known to be in the variable with id 'varId'
+//  according to 'scratch', or 'NO_NODE' if it is not known.
+NodeInd getKnown  (const SyntaxTree&  tree,
+       const OptimizeScratch& scratch,
+       int      varId
+      )
+      throw()
+{
+  if  (scratch.knownBatchVect_[varId] != scratch.batch_)
+    return(NO_NODE);
+
+  NodeInd known = scratch.knownVect_[varId];
+
+  if  ( (known != NO_NODE)        &&
+  (tree.getSymbol(known) == ID_SYMBOL)    &&
+  (scratch.versionVect_[tree.getVarId(known)]
+      != scratch.knownVersionVect_[varId]
+  )
+      )
+    return(NO_NODE);
+
+  return(known);
+}
+
+
+//  PURPOSE:  To replace the variable read by node 'parent' (its first value
+//  if it is an assignment, or its lhs otherwise, under any conversions) with
+//  its value known in 'scratch', if that is known.  Returns 1 if it was
+//  replaced, or 0 otherwise.
+size_t  replaceKnown  (TranslationState& state,
+       NodeInd  parent,
+       const OptimizeScratch& scratch
+      )
+      throw(const char*)
+{
+  SyntaxTree& tree  = state.tree_;
+  NodeInd value = (tree.getSymbol(parent) == ASSIGN_SYMBOL)
+        ? tree.getAssignedLhs(parent)
+        : tree.getLhs(parent);
+
+  while  (tree.getSymbol(value) == TYPE_CONVERT_SYMBOL)
+  {
+    parent  = value;
+    value = tree.getLhs(value);
+  }
+
+  if  (tree.getSymbol(value) != ID_SYMBOL)
+    return(0);
+
+  NodeInd known = getKnown(tree,scratch,tree.getVarId(value));
+
+  if  (known == NO_NODE)
+    return(0);
+
+  NodeInd newNode = tree.copyNode(known);
+
+  tree.setType(newNode,tree.getType(value));
+
+  if  (tree.getSymbol(parent) == ASSIGN_SYMBOL)
+    tree.setAssignedLhs(parent,newNode);
+  else
+    tree.setLhs(parent,newNode);
+
+  return(1);
+}
+
+
+//  PURPOSE:  To replace each variable read by the statement at node
+//  'statement' whose value is known in 'scratch' with that value: a literal,
+//  or another variable that holds the same value.  Returns the number of
+//  variables replaced.
+size_t  propagateValues (TranslationState& state,
+       NodeInd  statement,
+       const OptimizeScratch& scratch
+      )
+      throw(const char*)
+{
+  const SyntaxTree& tree  = state.tree_;
+  size_t  numReplaced = 0;
+
+  switch  (tree.getSymbol(statement))
+  {
+  case PRINT_SYMBOL :
+    numReplaced += replaceKnown(state,statement,scratch);
+    break;
+
+  case ASSIGN_SYMBOL :
+    numReplaced += replaceKnown(state,statement,scratch);
+
+    for  (NodeInd node = unconverted(tree,tree.getAssignedRhs(statement));
+          node != NO_NODE;
+          node = unconverted(tree,tree.getRhs(node))
+         )
+      numReplaced += replaceKnown(state,node,scratch);
+    break;
+
+  default :
+    break;
+  }
+
+  return(numReplaced);
+}
+
+
+//  PURPOSE:  To record in 'scratch' the value that the statement at
+//  node 'statement' of 'tree' gives its variable, if that value is a short
+//  literal or another variable, and to forget the values of the variables
+//  that were copies of the old one.  (Long literals are not copied about,
+//  lest the 'dc' code grow.)  No return value.
+void  noteKnownValue  (const SyntaxTree&  tree,
+       NodeInd    statement,
+       OptimizeScratch& scratch
+      )
+      throw()
+{
+  const size_t  MAX_KNOWN_LITERAL_LEN = 32;
+
+  if  (tree.getSymbol(statement) != ASSIGN_SYMBOL)
+    return;
+
+  int     varId   = tree.getVarId(tree.getAssignedVar(statement));
+  NodeInd value   = unconverted(tree,tree.getAssignedLhs(statement));
+  bool    isKnown   = (unconverted(tree,tree.getAssignedRhs(statement))
+           == NO_NODE
+          );
+
+  scratch.versionVect_[varId]++;
+
+  if  (tree.getSymbol(value) == ID_SYMBOL)
+  {
+    isKnown = isKnown  &&  (tree.getVarId(value) != varId);
+
+    if  (isKnown)
+      scratch.knownVersionVect_[varId]
+          = scratch.versionVect_[tree.getVarId(value)];
+  }
+  else
+    isKnown = isKnown  &&
+        (tree.getLiteralLength(value) <= MAX_KNOWN_LITERAL_LEN);
+
+  scratch.knownVect_[varId]   = isKnown ? value : NO_NODE;
+  scratch.knownBatchVect_[varId]  = scratch.batch_;
+}
+
+
+//  PURPOSE:  To tell from 'scratch' if the variable with id 'varId' is read
+//  before it is next assigned.  'isEndOfProgram' tells if no statements
+//  follow the batch.
+bool  isLive    (const OptimizeScratch& scratch,
+       int      varId,
+       bool     isEndOfProgram
+      )
+      throw()
+{
+  return( (scratch.liveBatchVect_[varId] == scratch.batch_)
+    ? scratch.isLiveVect_[varId]
+    : !isEndOfProgram
+  );
+}
+
+
+//  PURPOSE:  To note in 'scratch' whether the variable with id 'varId' is
+//  read before it is next assigned.  No return value.
+void  setIsLive (OptimizeScratch& scratch,
+       int      varId,
+       bool     isVarLive
+      )
+      throw()
+{
+  scratch.isLiveVect_[varId]    = isVarLive;
+  scratch.liveBatchVect_[varId] = scratch.batch_;
+}
+
+
+//  PURPOSE:  To note in 'scratch' that the variable read at node 'node' of
+//  'tree' (under any conversions), if it is one, is live.  No return value.
+void  markRead  (const SyntaxTree&  tree,
+       NodeInd    node,
+       OptimizeScratch& scratch
+      )
+      throw()
+{
+  node  = unconverted(tree,node);
+
+  if  (tree.getSymbol(node) == ID_SYMBOL)
+    setIsLive(scratch,tree.getVarId(node),true);
+}
+
+
+//  PURPOSE:  To remove from 'statementList' each assignment to a variable
+//  that is assigned again before it is next read.  The variables assigned by
+//  the last statements count as never read again only if 'isEndOfProgram'
+//  is 'true'.  Works in 'scratch'.  Returns the number of statements
+//  removed.
+size_t  removeDeadStores(const SyntaxTree&  tree,
+       StatementList& statementList,
+       bool   isEndOfProgram,
+       OptimizeScratch& scratch
+      )
+      throw()
+{
+  size_t  numRemoved  = 0;
+
+  for  (size_t i = statementList.size();  i-- > 0; )
+  {
+    NodeInd statement = statementList[i];
+
+    if  (tree.getSymbol(statement) == PRINT_SYMBOL)
+    {
+      markRead(tree,tree.getLhs(statement),scratch);
+      continue;
+    }
+
+    int   varId = tree.getVarId(tree.getAssignedVar(statement));
+
+    if  ( !isLive(scratch,varId,isEndOfProgram) )
+    {
+      statementList[i]  = NO_NODE;
+      numRemoved++;
+      continue;
+    }
+
+    setIsLive(scratch,varId,false);
+    markRead(tree,tree.getAssignedLhs(statement),scratch);
+
+    for  (NodeInd node = unconverted(tree,tree.getAssignedRhs(statement));
+          node != NO_NODE;
+          node = unconverted(tree,tree.getRhs(node))
+         )
+      markRead(tree,tree.getLhs(node),scratch);
+  }
+
+  size_t  toInd = 0;
+
+  for  (size_t fromInd = 0;  fromInd < statementList.size();  fromInd++)
+    if  (statementList[fromInd] != NO_NODE)
+      statementList[toInd++]  = statementList[fromInd];
+
+  statementList.resize(toInd);
+  return(numRemoved);
+}
+
+
+//  PURPOSE:  To improve the (checked) statements in 'statementList' before
+//  they are output.  A forward pass copies known values into later
+//  statements and folds the constants of each, and a backward pass then
+//  removes the assignments never read.  'isEndOfProgram' tells if no
+//  statements follow these.  Works in 'scratch', and adds what was done to
+//  'stats'.  No return value.
+void  optimizeStatements(TranslationState& state,
+       StatementList& statementList,
+       bool   isEndOfProgram,
+       OptimizeScratch& scratch,
+       TranslationStats&  stats
+      )
+      throw(const char*)
+{
+  size_t  numVars = state.symbolTable_.getNumVars();
+
+  scratch.knownVect_.resize(numVars,NO_NODE);
+  scratch.knownBatchVect_.resize(numVars,0);
+  scratch.knownVersionVect_.resize(numVars,0);
+  scratch.versionVect_.resize(numVars,0);
+  scratch.isLiveVect_.resize(numVars,false);
+  scratch.liveBatchVect_.resize(numVars,0);
+  scratch.batch_++;
+
+  for  (size_t i = 0;  i < statementList.size();  i++)
+  {
+    stats.numValuesPropagated_
+      += propagateValues(state,statementList[i],scratch);
+    stats.numNodesFolded_ += foldConstants(state,statementList[i],
+              scratch.foldScratch_
+             );
+    noteKnownValue(state.tree_,statementList[i],scratch);
+  }
+
+  stats.numStatementsRemoved_
+      += removeDeadStores(state.tree_,statementList,isEndOfProgram,scratch);
+}
+
+
+//  PURPOSE:  To append to 'dcCode' the 'dc' instructions that implement the
+//  program at node 'node'.  A chain of '+', '-' and conversion nodes is
+//  walked down once, noting its nodes in 'chainVect' above those already
+//  there, and then output from its end back, so stack use does not grow
+//  with its length.  No return value.
+void  outputForDC (TranslationState& state,
+       NodeInd  node,
+       std::vector<NodeInd>&  chainVect,
+       DcCode&  dcCode
+      )
+{
+  const SyntaxTree& tree  = state.tree_;
+
+  switch  (tree.getSymbol(node))
+  {
+  case INT_SYMBOL :
+  case FLOAT_SYMBOL :
+    dcCode.appendNumber(state.literalPool_.getText(tree.getLiteral(node)),
+            tree.getLiteralLength(node)
+           );
+    break;
+
+  case ID_SYMBOL :
+    dcCode.appendVar(LOAD_DC_OP,tree.getVarId(node));
+    break;
+
+  case ADD_SYMBOL :
+  case SUBTRACT_SYMBOL :
+  case TYPE_CONVERT_SYMBOL :
+    {
+      size_t  firstInd  = chainVect.size();
+
+      while  (node != NO_NODE)
+      {
+        chainVect.push_back(node);
+
+        switch  (tree.getSymbol(node))
+        {
+        case ADD_SYMBOL :
+        case SUBTRACT_SYMBOL :
+          node  = tree.getRhs(node);
+          break;
+
+        case TYPE_CONVERT_SYMBOL :
+          node  = tree.getLhs(node);
+          break;
+
+        default :
+          node  = NO_NODE;
+          break;
+        }
+      }
+
+      for  (size_t i = chainVect.size();  i-- > firstInd; )
+      {
+        NodeInd link  = chainVect[i];
+
+        switch  (tree.getSymbol(link))
+        {
+        case ADD_SYMBOL :
+          outputForDC(state,tree.getLhs(link),chainVect,dcCode);
+          dcCode.append(ADD_DC_OP);
+          break;
+
+        case SUBTRACT_SYMBOL :
+          outputForDC(state,tree.getLhs(link),chainVect,dcCode);
+          dcCode.append(SUBTRACT_DC_OP);
+          break;
+
+        case TYPE_CONVERT_SYMBOL :
+          dcCode.appendInt(PRECISION_DC_OP,5);
+          break;
+
+        default :
+          outputForDC(state,link,chainVect,dcCode);
+          break;
+        }
+      }
+
+      chainVect.resize(firstInd);
+    }
+    break;
+
+  case PRINT_SYMBOL :
+    outputForDC(state,tree.getLhs(node),chainVect,dcCode);
+    dcCode.append(PRINT_DC_OP);
+    dcCode.append(DISCARD_DC_OP);
+    break;
+
+  case ASSIGN_SYMBOL :
+    outputForDC(state,tree.getAssignedLhs(node),chainVect,dcCode);
+    outputForDC(state,tree.getAssignedRhs(node),chainVect,dcCode);
+    dcCode.appendVar(STORE_DC_OP,tree.getVarId(tree.getAssignedVar(node)));
+    dcCode.appendInt(PRECISION_DC_OP,0);
+    break;
+
+  default :
+    break;
+  }
+
+}
+
+
+//  PURPOSE:  To append to 'dcCode' the 'dc' instructions that implement each
+//  statement in 'statementList', in order.  No return value.
+void  outputForDC (TranslationState& state,
+       StatementList& statementList,
+       DcCode&  dcCode
+      )
+{
+  std::vector<NodeInd>  chainVect;
+
+  for  (size_t i = 0;  i < statementList.size();  i++)
+    outputForDC(state,statementList[i],chainVect,dcCode);
+}
+
+
+//  PURPOSE:  To translate the whole program from 'tokenStream' into 'dc'
+//  code, working in 'state', and either to write it to 'out' or, if
+//  'machinePtr' is not 'NULL', to run it on '*machinePtr'.  If 'nativePtr'
+//  is not 'NULL', the checked statements are run as native code on
+//  '*nativePtr' instead.  Statements are parsed, checked and output a batch
+//  at a time, and their nodes are then given back to the 'SyntaxTree', their
+//  literals to the 'LiteralPool' and the input they came from (if mapped)
+//  to the kernel, so memory use does not grow with the program.  (The token looked ahead at between batches is never a
+//  number, so no literal is lost.)  If 'shouldOptimize' is 'true',
+//  runs 'optimizeStatements()' over each batch and the peephole optimizer
+//  over its 'dc' code.  Adds what was done to 'stats'.  No return value.
+void  translateProg (TranslationState& state,
+       TokenStream& tokenStream,
+       bool   shouldOptimize,
+       DcMachine* machinePtr,
+       NativeMachine* nativePtr,
+       std::ostream&  out,
+       TranslationStats&  stats
+      )
+      throw(const char*)
+{
+  const size_t  STATEMENTS_PER_BATCH  = 4096;
+  StatementList statementList;
+  DcCode  dcCode(state.symbolTable_);
+  OptimizeScratch scratch;
+
+  scratch.batch_  = 0;
+  state.symbolTable_.clearTypes();
+  parseDeclares(state,tokenStream);
+
+  do
+  {
+    parseStatements(state,tokenStream,statementList,STATEMENTS_PER_BATCH);
+    checkConsistency(state,statementList);
+
+    if  (shouldOptimize)
+      optimizeStatements(state,statementList,
+             tokenStream.peek() == END_OF_FILE_SYMBOL,
+             scratch,
+             stats
+            );
+
+    if  (nativePtr != NULL)
+      nativePtr->run(statementList);
+    else
+    {
+      outputForDC(state,statementList,dcCode);
+      stats.numInstructionsBefore_  += dcCode.getNumInstructions();
+
+      if  (shouldOptimize)
+        dcCode.optimize();
+
+      stats.numInstructionsAfter_ += dcCode.getNumInstructions();
+
+      if  (machinePtr != NULL)
+        machinePtr->run(dcCode);
+      else
+        dcCode.write(out);
+
+      dcCode.clear();
+    }
+    statementList.clear();
+    state.tree_.rewind();
+    state.literalPool_.clear();
+    tokenStream.releasePassedInput();
+  }
+  while  (tokenStream.peek() != END_OF_FILE_SYMBOL);
+
+  expect(tokenStream,END_OF_FILE_SYMBOL);
+  out.flush();
+}
+
+
+/*---*
+ *---*    Functions used to measure performance:
+ *---*/
+
+//  PURPOSE:  To return the number of seconds since some fixed time.  No
+//  parameters.
+double  nowInSeconds  ()
+      throw()
+{
+  struct timeval  now;
+
+  gettimeofday(&now,NULL);
+  return(now.tv_sec + now.tv_usec / 1e6);
+}
+
+
+//  PURPOSE:  To return the text of an ac program with 'numStatements'
+//  statements that mix int and float assignments with prints.
+std::string
+  generateProgram (size_t numStatements
+      )
+{
+  std::string program("i a f b");
+
+  for  (size_t i = 0;  i < numStatements;  i++)
+    if  (i % 7 == 0)
+      program += " p b";
+    else
+    if  (i % 3 != 0)
+      program += " a = a + 1";
+    else
+      program += " b = b - a + 2.5";
+
+  return(program);
+}
+
+
+//  PURPOSE:  To return the text of an ac program with 'numStatements'
+//  statements that add and subtract float literals of 'numDigits' digits
+//  each, half of them after the point.
+std::string
+  generateBigProgram  (size_t numDigits,
+       size_t numStatements
+      )
+{
+  std::string program("f a f b");
+  std::string literal;
+
+  for  (size_t i = 0;  i < numDigits;  i++)
+    literal += (char)('1' + i % 9);
+
+  literal.insert(numDigits / 2,1,'.');
+
+  for  (size_t i = 0;  i < numStatements;  i++)
+    if  (i % 7 == 0)
+      program += " p b";
+    else
+    if  (i % 2 != 0)
+      program += " a = a + " + literal;
+    else
+      program += " b = b - a + " + literal;
+
+  return(program);
+}
+
+
+//  PURPOSE:  To time translating and running in-process a generated program
+//  of 'numStatements' statements on 'numDigits'-digit literals, and to
+//  report it on 'std::cerr'.  Returns 'EXIT_SUCCESS' on success or
+//  'EXIT_FAILURE' otherwise.
+int   benchmarkDigits (size_t numDigits,
+       size_t numStatements
+      )
+{
+  std::string   program = generateBigProgram(numDigits,numStatements);
+  TranslationState  state;
+  TranslationStats  stats = { 0, 0, 0, 0, 0 };
+  double    runTime;
+
+  try
+  {
+    std::ostringstream  runOut;
+    DcMachine     machine(runOut);
+    InputCharStream   runChars(program);
+    TokenStream     runTokens(runChars,state.literalPool_,state.symbolTable_);
+    double      startTime = nowInSeconds();
+
+    translateProg(state,runTokens,true,&machine,NULL,runOut,stats);
+    runTime = nowInSeconds() - startTime;
+  }
+  catch  (const char* cPtr
+   )
+  {
+    std::cerr << cPtr << '\n';
+    return(EXIT_FAILURE);
+  }
+
+  std::cerr << numStatements << " statements on " << numDigits
+      << "-digit literals: " << runTime << " s ("
+      << (runTime * 1e9 / numStatements) << " ns/statement)\n";
+  return(EXIT_SUCCESS);
+}
+
+
+//  PURPOSE:  To time running a generated program of 'numStatements'
+//  statements in-process and as native code against translating it and
+//  piping the text to a 'dc' process, and to report them on 'std::cerr'.
+//  Returns 'EXIT_SUCCESS' on success or 'EXIT_FAILURE' otherwise.
+int   benchmarkRun  (size_t numStatements
+      )
+{
+  std::string   program = generateProgram(numStatements);
+  TranslationState  state;
+  TranslationStats  stats = { 0, 0, 0, 0, 0 };
+  double    startTime;
+  double    inProcessTime;
+  double    nativeTime;
+  double    pipeTime;
+  int     pipeStatus;
+
+  try
+  {
+    std::ostringstream  runOut;
+    DcMachine     machine(runOut);
+    InputCharStream   runChars(program);
+    TokenStream     runTokens(runChars,state.literalPool_,state.symbolTable_);
+
+    startTime = nowInSeconds();
+    translateProg(state,runTokens,true,&machine,NULL,runOut,stats);
+    inProcessTime = nowInSeconds() - startTime;
+
+    std::ostringstream  nativeOut;
+    NativeMachine   native(state.symbolTable_,state.tree_,
+           state.literalPool_,nativeOut);
+    InputCharStream   nativeChars(program);
+    TokenStream     nativeTokens(nativeChars,state.literalPool_,
+             state.symbolTable_
+            );
+
+    startTime = nowInSeconds();
+    translateProg(state,nativeTokens,true,NULL,&native,nativeOut,stats);
+    nativeTime  = nowInSeconds() - startTime;
+
+    if  (nativeOut.str() != runOut.str())
+      throw "Native code printed something else";
+
+    std::ostringstream  dcText;
+    InputCharStream   pipeChars(program);
+    TokenStream     pipeTokens(pipeChars,state.literalPool_,state.symbolTable_);
+
+    startTime = nowInSeconds();
+    translateProg(state,pipeTokens,true,NULL,NULL,dcText,stats);
+    signal(SIGPIPE,SIG_IGN);
+
+    FILE*   pipePtr   = popen("dc > /dev/null 2>&1","w");
+
+    if  (pipePtr == NULL)
+      throw "Cannot start dc";
+
+    fwrite(dcText.str().data(),1,dcText.str().length(),pipePtr);
+    pipeStatus  = pclose(pipePtr);
+    pipeTime  = nowInSeconds() - startTime;
+  }
+  catch  (const char* cPtr
+   )
+  {
+    std::cerr << cPtr << '\n';
+    return(EXIT_FAILURE);
+  }
+
+  std::cerr << numStatements << " statements: in-process "
+      << inProcessTime << " s, native " << nativeTime << " s";
+
+  if  ( WIFEXITED(pipeStatus) && (WEXITSTATUS(pipeStatus) == 0) )
+    std::cerr << ", piped to dc " << pipeTime << " s ("
+        << (pipeTime / inProcessTime) << "x)\n";
+  else
+    std::cerr << ", dc not available\n";
+
+  return(EXIT_SUCCESS);
+}
+
+
+
+//  PURPOSE:  To return the text of an ac program of shape 'shape' whose size
+//  grows with 'size': "declarations" declares 'size' variables, "statements"
+//  is a list of 'size' short statements, "chains" has 'size'/100
+//  statements each a '+'/'-' chain of 1000 values, and "mixed" has 'size'
+//  statements that mix int and float variables and literals, so that many
+//  conversions are needed.
+std::string
+  generateShapedProgram (const std::string& shape,
+       size_t   size
+      )
+{
+  const size_t    CHAIN_LENGTH  = 1000;
+  std::ostringstream  program;
+
+  if  (shape == "declarations")
+  {
+    for  (size_t i = 0;  i < size;  i++)
+      program << ((i % 2 == 0) ? "i v" : "f v") << i << ' ';
+
+    for  (size_t i = 0;  i < size;  i += 10)
+      program << "v" << i << " = " << i << " p v" << i << ' ';
+  }
+  else
+  if  (shape == "statements")
+    return(generateProgram(size));
+  else
+  if  (shape == "chains")
+  {
+    program << "i a f b";
+
+    for  (size_t i = 0;  i < size / 100;  i++)
+    {
+      program << " b = a";
+
+      for  (size_t j = 1;  j < CHAIN_LENGTH;  j++)
+        program << ((j % 2 == 0) ? " + " : " - ")
+          << ((j % 3 == 0) ? "b" : (j % 3 == 1) ? "a" : "2.5");
+
+      program << " p b";
+    }
+  }
+  else
+  if  (shape == "mixed")
+  {
+    const char* STATEMENTS[]  = { " b = a + 1.5 - c", " d = b + a + 2",
+              " a = c + 3", " c = a - 2 + 0.25",
+              " p d"
+            };
+    const size_t  NUM_STATEMENTS  = sizeof(STATEMENTS)
+              / sizeof(STATEMENTS[0]);
+
+    program << "i a i c f b f d";
+
+    for  (size_t i = 0;  i < size;  i++)
+      program << STATEMENTS[i % NUM_STATEMENTS];
+  }
+  else
+  if  (shape == "padded")
+  {
+    //  As a program writer might: a statement a line, indented, with long
+    //  literals.
+    program << "i a\nf b\n";
+
+    for  (size_t i = 0;  i < size;  i++)
+    {
+      program << "        b = a + " << (i % 9 + 1)
+        << "234567890123456789012345678.5\t\t- "
+        << i * 7919 % 1000000007 << "000000000000\n";
+
+      if  (i % 4 == 3)
+        program << "\n        p b\n\n";
+    }
+  }
+  else
+    throw "Unknown program shape";
+
+  return(program.str());
+}
+
+
+//  PURPOSE:  To report on 'std::cerr' how many MB/s the scanner tokenizes
+//  with each way of skipping runs of whitespace and digits, on generated
+//  programs of several shapes with size 'size'.  Each is the best of
+//  several repetitions, and each way must give the same tokens.  Returns
+//  'EXIT_SUCCESS' on success or 'EXIT_FAILURE' otherwise.
+int   benchmarkScan (size_t size
+      )
+{
+  const char* SHAPE_NAMES[] = { "statements", "mixed", "padded" };
+  const int   NUM_SHAPES  = sizeof(SHAPE_NAMES) / sizeof(SHAPE_NAMES[0]);
+  const scanMode_t  SCAN_MODES[]  = { SCALAR_SCAN_MODE, SSE2_SCAN_MODE,
+            AVX2_SCAN_MODE
+          };
+  const char* SCAN_MODE_NAMES[] = { "scalar", "sse2", "avx2" };
+  const int   NUM_SCAN_MODES  = sizeof(SCAN_MODES) / sizeof(SCAN_MODES[0]);
+  const int   NUM_REPETITIONS = 5;
+  TranslationState  state;
+
+  for  (int shapeInd = 0;  shapeInd < NUM_SHAPES;  shapeInd++)
+  {
+    std::string program;
+    size_t    firstNumTokens  = 0;
+    size_t    firstTokenSum = 0;
+
+    try
+    {
+      program = generateShapedProgram(SHAPE_NAMES[shapeInd],size);
+      std::cerr << SHAPE_NAMES[shapeInd] << ": " << program.length()
+          << " bytes\n";
+
+      for  (int modeInd = 0;  modeInd < NUM_SCAN_MODES;  modeInd++)
+      {
+        double    bestTime  = 1e30;
+        size_t    numTokens = 0;
+        size_t    tokenSum  = 0;
+        scanMode_t  scanMode  = SCAN_MODES[modeInd];
+
+        for  (int rep = 0;  rep < NUM_REPETITIONS;  rep++)
+        {
+          state.literalPool_.clear();
+          state.symbolTable_.clear();
+
+          double    startTime = nowInSeconds();
+          InputCharStream inputCharStream(program);
+
+          inputCharStream.setScanMode(scanMode);
+          scanMode  = inputCharStream.getScanMode();
+
+          TokenStream   tokenStream(inputCharStream,state.literalPool_,
+                  state.symbolTable_
+                 );
+
+          //  Sum what the tokens hold, so that each way must find them
+          //  all alike:
+          for  (numTokens = tokenSum = 0;
+                tokenStream.peek() != END_OF_FILE_SYMBOL;
+                numTokens++
+               )
+          {
+            Symbol  symbol  = tokenStream.advance();
+
+            tokenSum  += symbol.symbol_;
+
+            if  ( (symbol.symbol_ == INT_SYMBOL)  ||
+            (symbol.symbol_ == FLOAT_SYMBOL)
+          )
+              tokenSum  += symbol.value_.literal_.offset_ * 3
+                + symbol.value_.literal_.length_;
+          }
+
+          double    time  = nowInSeconds() - startTime;
+
+          if  (time < bestTime)
+            bestTime  = time;
+        }
+
+        if  (modeInd == 0)
+        {
+          firstNumTokens  = numTokens;
+          firstTokenSum = tokenSum;
+        }
+        else
+        if  ( (numTokens != firstNumTokens)  ||  (tokenSum != firstTokenSum) )
+          throw "Ways of scanning give different tokens";
+
+        char  line[128];
+
+        snprintf(line,sizeof(line),"  %-8s %10.3f ms %10.1f MB/s%s\n",
+           SCAN_MODE_NAMES[modeInd],bestTime * 1e3,
+           program.length() / 1e6 / ((bestTime > 0) ? bestTime : 1e-9),
+           (scanMode == SCAN_MODES[modeInd]) ? "" : " (not on this CPU)"
+          );
+        std::cerr << line;
+      }
+    }
+    catch  (const char* cPtr
+     )
+    {
+      std::cerr << SHAPE_NAMES[shapeInd] << ": " << cPtr << '\n';
+      return(EXIT_FAILURE);
+    }
+  }
+
+  return(EXIT_SUCCESS);
+}
+
+
+//  PURPOSE:  To return the most memory the process has had resident, in
+//  kilobytes.  No parameters.
+long  getPeakRssKb ()
+      throw()
+{
+  struct rusage usage;
+
+  getrusage(RUSAGE_SELF,&usage);
+  return(usage.ru_maxrss);
+}
+
+
+//  PURPOSE:  To time each phase of translation separately on generated
+//  programs of each shape of 'generateShapedProgram()' with size 'size',
+//  and to report ns/token, ns/node and peak RSS: as a table on 'std::cerr',
+//  or as JSON on 'std::cout' if 'shouldWriteJson'.  The phases are
+//  scanning alone ("tokenize"), parsing (which scans too), type checking,
+//  turning the tree into 'dc' instructions ("emit"), writing them as text,
+//  and the optimizer.  (Giving the tree back is not timed: it is an arena
+//  rewind, the same for any program.)  Each is the best of several
+//  repetitions.  Returns 'EXIT_SUCCESS' on success or
+//  'EXIT_FAILURE' otherwise.
+int   benchmarkPhases (size_t size,
+       bool   shouldWriteJson
+      )
+{
+  const char* SHAPE_NAMES[] = { "declarations", "statements", "chains",
+            "mixed"
+          };
+  const int   NUM_SHAPES  = sizeof(SHAPE_NAMES) / sizeof(SHAPE_NAMES[0]);
+  const char* PHASE_NAMES[] = { "tokenize", "parse", "check", "emit",
+            "write", "optimize"
+          };
+  const int   NUM_PHASES  = sizeof(PHASE_NAMES) / sizeof(PHASE_NAMES[0]);
+  const int   NUM_REPETITIONS = 5;
+  TranslationState  state;
+  TranslationStats  stats = { 0, 0, 0, 0, 0 };
+
+  if  (shouldWriteJson)
+    std::cout << "{\"size\": " << size << ", \"shapes\": [";
+
+  for  (int shapeInd = 0;  shapeInd < NUM_SHAPES;  shapeInd++)
+  {
+    std::string program;
+    double    bestTimeArray[NUM_PHASES];
+    size_t    numTokens = 0;
+    size_t    numNodes  = 0;
+
+    for  (int phase = 0;  phase < NUM_PHASES;  phase++)
+      bestTimeArray[phase]  = 1e30;
+
+    try
+    {
+      program = generateShapedProgram(SHAPE_NAMES[shapeInd],size);
+
+      for  (int rep = 0;  rep < NUM_REPETITIONS;  rep++)
+      {
+        double    timeArray[NUM_PHASES];
+        double    startTime;
+
+        //  I.  Scan alone:
+        state.literalPool_.clear();
+        state.symbolTable_.clear();
+        startTime = nowInSeconds();
+        {
+          InputCharStream inputCharStream(program);
+          TokenStream   tokenStream(inputCharStream,state.literalPool_,
+                  state.symbolTable_
+                 );
+
+          for  (numTokens = 0;
+                tokenStream.peek() != END_OF_FILE_SYMBOL;
+                numTokens++
+               )
+            tokenStream.advance();
+        }
+        timeArray[0]  = nowInSeconds() - startTime;
+
+        //  II.  Parse, check, emit and write:
+        StatementList statementList;
+        DcCode    dcCode(state.symbolTable_);
+        std::ostringstream  out;
+        OptimizeScratch scratch;
+
+        scratch.batch_  = 0;
+        state.literalPool_.clear();
+        state.symbolTable_.clear();
+        startTime = nowInSeconds();
+        {
+          InputCharStream inputCharStream(program);
+          TokenStream   tokenStream(inputCharStream,state.literalPool_,
+                  state.symbolTable_
+                 );
+
+          parseDeclares(state,tokenStream);
+          parseStatements(state,tokenStream,statementList,
+              program.length()
+             );
+        }
+        timeArray[1]  = nowInSeconds() - startTime;
+
+        startTime = nowInSeconds();
+        checkConsistency(state,statementList);
+        timeArray[2]  = nowInSeconds() - startTime;
+
+        numNodes  = 0;
+
+        for  (size_t i = 0;  i < statementList.size();  i++)
+          numNodes  += countNodes(state.tree_,statementList[i]);
+
+        startTime = nowInSeconds();
+        outputForDC(state,statementList,dcCode);
+        timeArray[3]  = nowInSeconds() - startTime;
+
+        startTime = nowInSeconds();
+        dcCode.write(out);
+        timeArray[4]  = nowInSeconds() - startTime;
+
+        //  III.  Optimize, and give the tree back:
+        startTime = nowInSeconds();
+        optimizeStatements(state,statementList,true,scratch,stats);
+        timeArray[5]  = nowInSeconds() - startTime;
+
+        state.tree_.rewind();
+        state.literalPool_.clear();
+
+        for  (int phase = 0;  phase < NUM_PHASES;  phase++)
+          if  (timeArray[phase] < bestTimeArray[phase])
+            bestTimeArray[phase]  = timeArray[phase];
+      }
+    }
+    catch  (const char* cPtr
+     )
+    {
+      std::cerr << SHAPE_NAMES[shapeInd] << ": " << cPtr << '\n';
+      return(EXIT_FAILURE);
+    }
+
+    //  Avoid dividing by 0 for tiny programs:
+    double    perToken  = 1e9 / ((numTokens == 0) ? 1 : numTokens);
+    double    perNode   = 1e9 / ((numNodes  == 0) ? 1 : numNodes);
+
+    if  (shouldWriteJson)
+    {
+      std::cout << ((shapeInd == 0) ? "\n" : ",\n")
+          << "  {\"shape\": \"" << SHAPE_NAMES[shapeInd]
+          << "\", \"bytes\": " << program.length()
+          << ", \"tokens\": " << numTokens
+          << ", \"nodes\": " << numNodes
+          << ", \"peakRssKb\": " << getPeakRssKb()
+          << ", \"phases\": {";
+
+      for  (int phase = 0;  phase < NUM_PHASES;  phase++)
+        std::cout << ((phase == 0) ? "" : ", ")
+            << "\"" << PHASE_NAMES[phase] << "\": {\"ns\": "
+            << (long long)(bestTimeArray[phase] * 1e9)
+            << ", \"nsPerToken\": " << bestTimeArray[phase] * perToken
+            << ", \"nsPerNode\": " << bestTimeArray[phase] * perNode
+            << "}";
+
+      std::cout << "}}";
+      continue;
+    }
+
+    std::cerr << SHAPE_NAMES[shapeInd] << ": " << program.length()
+        << " bytes, " << numTokens << " tokens, " << numNodes
+        << " nodes, peak RSS " << getPeakRssKb() << " kB\n";
+
+    for  (int phase = 0;  phase < NUM_PHASES;  phase++)
+    {
+      char  line[128];
+
+      snprintf(line,sizeof(line),
+         "  %-9s %10.3f ms %9.2f ns/token %9.2f ns/node\n",
+         PHASE_NAMES[phase],bestTimeArray[phase] * 1e3,
+         bestTimeArray[phase] * perToken,
+         bestTimeArray[phase] * perNode
+        );
+      std::cerr << line;
+    }
+  }
+
+  if  (shouldWriteJson)
+    std::cout << "\n]}\n";
+
+  return(EXIT_SUCCESS);
+}
+
+
+//  PURPOSE:  To check that translating grows linearly with the program, on
+//  generated programs of 'numStatements'/4, 'numStatements'/2 and
+//  'numStatements' statements, and to report the time, ns/statement and
+//  how far translating raised the peak RSS for each on 'std::cerr'.  Fails
+//  if a program cannot be translated (as when statements once recursed and
+//  overflowed the stack), if the largest takes more than twice as long a
+//  statement as the smallest, or if translating raises the peak RSS by more
+//  than 'MAX_RSS_GROWTH_KB'.  Returns 'EXIT_SUCCESS' on success or
+//  'EXIT_FAILURE' otherwise.
+int   stressTranslate (size_t numStatements
+      )
+{
+  const int   NUM_SIZES = 3;
+  const long    MAX_RSS_GROWTH_KB = 64 * 1024;
+  double    nsPerStatementArray[NUM_SIZES];
+  long      rssGrowthKb = 0;
+  TranslationStats  stats = { 0, 0, 0, 0, 0 };
+  std::ofstream   out("/dev/null");
+
+  for  (int sizeInd = 0;  sizeInd < NUM_SIZES;  sizeInd++)
+  {
+    size_t    size    = numStatements >> (NUM_SIZES - 1 - sizeInd);
+    std::string   program = generateProgram(size);
+    TranslationState  state;
+    long      rssBeforeKb = getPeakRssKb();
+    double    startTime = nowInSeconds();
+
+    try
+    {
+      InputCharStream inputCharStream(program);
+      TokenStream tokenStream(inputCharStream,state.literalPool_,
+              state.symbolTable_
+             );
+
+      translateProg(state,tokenStream,false,NULL,NULL,out,stats);
+    }
+    catch  (const char* cPtr
+     )
+    {
+      std::cerr << size << " statements: " << cPtr << '\n';
+      return(EXIT_FAILURE);
+    }
+
+    double    time  = nowInSeconds() - startTime;
+
+    nsPerStatementArray[sizeInd]  = time * 1e9 / ((size == 0) ? 1 : size);
+    rssGrowthKb = getPeakRssKb() - rssBeforeKb;
+    state.tree_.release();
+    std::cerr << size << " statements (" << program.length() << " bytes): "
+        << time << " s, " << nsPerStatementArray[sizeInd]
+        << " ns/statement, peak RSS +" << rssGrowthKb << " kB\n";
+  }
+
+  if  (nsPerStatementArray[NUM_SIZES-1] > 2 * nsPerStatementArray[0])
+  {
+    std::cerr << "Time per statement grew with the program\n";
+    return(EXIT_FAILURE);
+  }
+
+  if  (rssGrowthKb > MAX_RSS_GROWTH_KB)
+  {
+    std::cerr << "Memory grew with the program\n";
+    return(EXIT_FAILURE);
+  }
+
+  return(EXIT_SUCCESS);
+}
+
+
+//  PURPOSE:  To return the text of a random, well-typed ac program made
+//  from 'rand()', whose values stay small enough to run natively.
+std::string
+  generateRandomProgram ()
+{
+  const char*   VAR_NAMES[] = { "a", "b", "c", "d", "e", "g", "h", "j",
+            "k", "fb", "p2", "i_x", "Total"
+          };
+  const int   NUM_VARS  = sizeof(VAR_NAMES) / sizeof(VAR_NAMES[0]);
+  bool      isFloatArray[NUM_VARS];
+  std::ostringstream  program;
+
+  for  (int i = 0;  i < NUM_VARS;  i++)
+  {
+    isFloatArray[i] = (rand() % 2 == 0);
+    program << (isFloatArray[i] ? "f " : "i ") << VAR_NAMES[i] << ' ';
+  }
+
+  int   numStatements = 1 + rand() % 30;
+
+  for  (int i = 0;  i < numStatements;  i++)
+  {
+    int varInd  = rand() % NUM_VARS;
+
+    if  (rand() % 4 == 0)
+    {
+      program << "p " << VAR_NAMES[varInd] << ' ';
+      continue;
+    }
+
+    program << VAR_NAMES[varInd] << " =";
+
+    int   numTerms  = 1 + rand() % 4;
+    int   numVarTerms = 0;
+
+    for  (int j = 0;  j < numTerms;  j++)
+    {
+      int termInd = rand() % NUM_VARS;
+
+      if  (j > 0)
+        program << ( (rand() % 2 == 0) ? " +" : " -" );
+
+      if  ( (numVarTerms < 2)  &&  (rand() % 2 == 0)  &&
+      (isFloatArray[varInd] || !isFloatArray[termInd])
+          )
+      {
+        program << ' ' << VAR_NAMES[termInd];
+        numVarTerms++;
+      }
+      else
+      if  (isFloatArray[varInd]  &&  (rand() % 2 == 0))
+        program << ' ' << rand() % 1000 << '.'
+          << std::string(rand() % 4,'0' + rand() % 10);
+      else
+        program << ' ' << rand() % 1000;
+    }
+
+    program << ' ';
+  }
+
+  return(program.str());
+}
+
+
+//  PURPOSE:  To check, on the programs of 'CHECKED_PROGRAMS' and then on
+//  'numPrograms' random programs, that running them as native code (with
+//  and without the optimizer) prints what 'DcMachine' prints for them
+//  unoptimized, and to report each that does not on 'std::cerr'.  A program
+//  that runs natively without the optimizer but not with it also fails.
+//  Returns 'EXIT_SUCCESS' if all agree or 'EXIT_FAILURE' otherwise.
+int   checkNative (size_t numPrograms
+      )
+{
+  //  Programs the optimizer once got wrong:
+  const char* CHECKED_PROGRAMS[]  = { "f y i b b = 0 + y p b",
+              "i a f y i b b = 0 + a - y p b",
+              "f y i b y = 2.5 b = 0 - 0 + y + 1 p b"
+            };
+  const size_t  NUM_CHECKED_PROGRAMS  = sizeof(CHECKED_PROGRAMS)
+              / sizeof(CHECKED_PROGRAMS[0]);
+  TranslationState  state;
+  size_t  numFailed = 0;
+  size_t  numTooBig = 0;
+
+  srand(1);
+
+  for  (size_t i = 0;  i < NUM_CHECKED_PROGRAMS + numPrograms;  i++)
+  {
+    std::string   program = (i < NUM_CHECKED_PROGRAMS)
+            ? std::string(CHECKED_PROGRAMS[i])
+            : generateRandomProgram();
+    std::string   expected;
+    bool      didRunNatively  = false;
+
+    //  Start afresh, as a run that threw leaves its nodes and literals:
+    state.tree_.rewind();
+    state.literalPool_.clear();
+    TranslationStats  stats = { 0, 0, 0, 0, 0 };
+
+    try
+    {
+      std::ostringstream  runOut;
+      DcMachine     machine(runOut);
+      InputCharStream   runChars(program);
+      TokenStream     runTokens(runChars,state.literalPool_,state.symbolTable_);
+
+      translateProg(state,runTokens,false,&machine,NULL,runOut,stats);
+      expected  = runOut.str();
+    }
+    catch  (const char* cPtr
+     )
+    {
+      std::cerr << "dc machine failed (" << cPtr << "): " << program << '\n';
+      numFailed++;
+      continue;
+    }
+
+    for  (int shouldOptimize = 0;  shouldOptimize <= 1;  shouldOptimize++)
+    {
+      std::ostringstream  nativeOut;
+      NativeMachine   native(state.symbolTable_,state.tree_,
+             state.literalPool_,nativeOut);
+      InputCharStream   nativeChars(program);
+      TokenStream     nativeTokens(nativeChars,state.literalPool_,
+               state.symbolTable_
+              );
+
+      try
+      {
+        translateProg(state,nativeTokens,shouldOptimize != 0,NULL,&native,
+          nativeOut,stats
+         );
+      }
+      catch  (const char* cPtr
+       )
+      {
+        if  (didRunNatively)
+        {
+          std::cerr << "Native code failed (-O) (" << cPtr << "): "
+              << program << '\n';
+          numFailed++;
+        }
+        else
+          numTooBig++;
+
+        continue;
+      }
+
+      didRunNatively  = true;
+
+      if  (nativeOut.str() != expected)
+      {
+        std::cerr << "Native code differs" << (shouldOptimize ? " (-O)" : "")
+            << ": " << program << '\n';
+        numFailed++;
       }
+    }
+  }
+
+  std::cerr << NUM_CHECKED_PROGRAMS + numPrograms << " programs: "
+      << numFailed << " differ, "
+      << numTooBig << " runs too big to run natively\n";
+  return( (numFailed == 0) ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+
+
+/*---*
+ *---*    Functions used to translate many programs at once:
+ *---*/
+
+//  PURPOSE:  To translate many programs, each as one job of a
+//  'WorkStealingPool'.  Each worker has its own 'TranslationState', and
+//  each job writes only its own output and its own error slot, so the
+//  workers share nothing while they run.
+class BatchTranslator : public JobRunner
+{
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the paths of the '.ac' files to translate, or the
+  //  text of the programs if translating in memory.
+  const std::vector<std::string>&
+      sourceVect_;
+
+  //  PURPOSE:  To tell if 'sourceVect_' holds program text (whose 'dc' code
+  //  is made and then dropped) rather than paths.
+  bool      isInMemory_;
 
-  //  PURPOSE:  To return the type that is recorded for the variable named
-  //  'varName'.
-  dcType_t  lookUp  (char   varName
+  //  PURPOSE:  To tell if the programs should be optimized.
+  bool      shouldOptimize_;
+
+  //  PURPOSE:  To hold the state each worker translates in.
+  std::vector<TranslationState*>
+      stateVect_;
+
+  //  PURPOSE:  To hold what the optimizer did, per worker.
+  std::vector<TranslationStats>
+      statsVect_;
+
+  //  PURPOSE:  To hold the error of each job, or "" if it succeeded.
+  std::vector<std::string>
+      errorVect_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No default constructor:
+  BatchTranslator ();
+
+  //  No copy constructor:
+  BatchTranslator (const BatchTranslator&
+        );
+
+  //  No copy assignment op:
+  BatchTranslator&  operator=
+      (const BatchTranslator&
+        );
+
+  //  III.  Protected methods:
+protected :
+  //  PURPOSE:  To translate the text read by 'inputCharStream' in 'state',
+  //  writing the 'dc' code to 'out' and adding to 'stats'.  No return value.
+  void    translate (TranslationState&  state,
+         InputCharStream& inputCharStream,
+         std::ostream&    out,
+         TranslationStats&  stats
         )
       throw(const char*)
       {
-        return(typeArray_[getIndex(varName)]);
-      }
+        state.tree_.rewind();
+        state.literalPool_.clear();
+        state.symbolTable_.clear();
 
-};
+        TokenStream tokenStream(inputCharStream,state.literalPool_,
+              state.symbolTable_
+             );
 
+        translateProg(state,tokenStream,shouldOptimize_,NULL,NULL,out,stats);
+      }
 
-/*---*
- *---*    Global singletons:
- *---*/
+public:
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to translate the programs in
+  //  'newSourceVect' (text if 'newIsInMemory', else paths) on
+  //  'numWorkers' workers, optimizing them if 'newShouldOptimize'.
+  BatchTranslator (const std::vector<std::string>&  newSourceVect,
+         bool       newIsInMemory,
+         bool       newShouldOptimize,
+         int        numWorkers
+        ) :
+      sourceVect_(newSourceVect),
+      isInMemory_(newIsInMemory),
+      shouldOptimize_(newShouldOptimize),
+      errorVect_(newSourceVect.size())
+      {
+        TranslationStats  stats = { 0, 0, 0, 0, 0 };
 
-//  PURPOSE:  To holds the types of the symbols (well, variables) that occur
-//  in the parsed program.
-SymbolTable   symbolTable;
+        for  (int i = 0;  i < numWorkers;  i++)
+        {
+          stateVect_.push_back(new TranslationState);
+          statsVect_.push_back(stats);
+        }
+      }
 
+  //  PURPOSE:  To release resources.  No parameters.
+  ~BatchTranslator  ()
+      {
+        for  (size_t i = 0;  i < stateVect_.size();  i++)
+          delete(stateVect_[i]);
+      }
 
+  //  V.  Accessors:
+  //  PURPOSE:  To return the error of job 'jobInd', or "" if it succeeded.
+  const std::string&
+      getError  (size_t   jobInd
+        )
+        const
+      throw()
+      { return(errorVect_[jobInd]); }
 
-/*---*
- *---*    Functions used directly to parse:
- *---*/
+  //  VI.  Mutators:
 
-//  PURPOSE:  To ensure that a 'Symbol' instance of type 'expectedSymbol'
-//  occurs next in the token stream 'tokenStream'.  Returns pointer to
-//  symbol after successfully checked.
-Symbol* expect    (TokenStream& tokenStream,
-       symbol_t expectedSymbol
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To return the path of the 'dc' output for the '.ac' file at
+  //  'path': 'path' with its ".ac" replaced by (or, lacking one, followed by)
+  //  ".dc".
+  static
+  std::string getOutputPath
+      (const std::string& path
       )
-      throw(const char*)
-{
-  Symbol* symbolPtr = tokenStream.advance();
+      {
+        size_t  length  = path.length();
 
-  if  (symbolPtr->symbol_ != expectedSymbol)
-    throw "Unexpected symbol";
+        if  ( (length > 3)  &&  (path.compare(length-3,3,".ac") == 0) )
+          return(path.substr(0,length-3) + ".dc");
 
-  return(symbolPtr);
-}
+        return(path + ".dc");
+      }
+
+  //  PURPOSE:  To translate program 'jobInd' on the thread of worker
+  //  'workerInd'.  No return value.
+  void    runJob  (size_t   jobInd,
+         int    workerInd
+        )
+      throw()
+      {
+        TranslationState& state = *stateVect_[workerInd];
+        TranslationStats& stats = statsVect_[workerInd];
+        const std::string&  source  = sourceVect_[jobInd];
 
+        try
+        {
+          if  (isInMemory_)
+          {
+            std::ostringstream  out;
+            InputCharStream   inputCharStream(source);
 
-//  PURPOSE:  To parse a single variable declaration from 'tokenStream'.
-//  Returns 'NULL' as no 'Symbol' instances need to be created to declare
-//  a variable.
-Symbol* parseDeclare  (TokenStream& tokenStream
+            translate(state,inputCharStream,out,stats);
+            return;
+          }
+
+          MappedFile    mappedFile(source.c_str());
+          std::string   outputPath  = getOutputPath(source);
+          std::ofstream   out(outputPath.c_str());
+          InputCharStream inputCharStream(mappedFile);
+
+          try
+          {
+            if  (!out)
+              throw "Cannot create output";
+
+            translate(state,inputCharStream,out,stats);
+          }
+          catch  (const char* cPtr
+           )
+          {
+            errorVect_[jobInd]  = cPtr;
+          }
+
+          out.close();
+
+          if  ( errorVect_[jobInd].empty()  &&  !out )
+            errorVect_[jobInd]  = "Cannot write " + outputPath;
+
+          //  Leave no partial output for a program that failed:
+          if  ( !errorVect_[jobInd].empty() )
+            remove(outputPath.c_str());
+        }
+        catch  (const char* cPtr
+         )
+        {
+          errorVect_[jobInd]  = cPtr;
+        }
+        catch  (...)
+        {
+          errorVect_[jobInd]  = "Out of memory";
+        }
+      }
+
+};
+
+
+//  PURPOSE:  To append to 'pathVect' the path 'path' if it names a file, or
+//  the paths of the '.ac' files under it (in sorted order) if it names a
+//  directory.  Returns 'true' on success or 'false' if 'path' cannot be
+//  read.
+bool  collectSources  (const std::string& path,
+       std::vector<std::string>&  pathVect
       )
 {
-  Symbol* declarePtr;
-  Symbol* varPtr;
-  dcType_t  varType;
+  struct stat status;
 
-  if  (tokenStream.peek() == FLOAT_DECLARE_SYMBOL)
+  if  (stat(path.c_str(),&status) != 0)
+    return(false);
+
+  if  (!S_ISDIR(status.st_mode))
   {
-    declarePtr  = expect(tokenStream,FLOAT_DECLARE_SYMBOL);
-    varPtr  = expect(tokenStream,ID_SYMBOL);
-    varType = FLOAT_POINT_DC_TYPE;
+    pathVect.push_back(path);
+    return(true);
   }
-  else
-  if  (tokenStream.peek() == INT_DECLARE_SYMBOL)
+
+  DIR*    dirPtr  = opendir(path.c_str());
+
+  if  (dirPtr == NULL)
+    return(false);
+
+  std::vector<std::string>
+      entryVect;
+
+  for  (struct dirent* entryPtr = readdir(dirPtr);
+        entryPtr != NULL;
+        entryPtr = readdir(dirPtr)
+       )
   {
-    declarePtr  = expect(tokenStream,INT_DECLARE_SYMBOL);
-    varPtr  = expect(tokenStream,ID_SYMBOL);
-    varType = INTEGER_DC_TYPE;
+    std::string name  = entryPtr->d_name;
+
+    if  ( (name != ".")  &&  (name != "..") )
+      entryVect.push_back(path + '/' + name);
   }
-  else
-    throw "expected float or int declaration";
 
-  symbolTable.enter(varType,varPtr->value_.varName_);
-  free(varPtr);
-  free(declarePtr);
+  closedir(dirPtr);
+  std::sort(entryVect.begin(),entryVect.end());
+
+  for  (size_t i = 0;  i < entryVect.size();  i++)
+  {
+    const std::string&  entry = entryVect[i];
+    size_t      length  = entry.length();
+
+    if  ( (stat(entry.c_str(),&status) == 0)  &&  S_ISDIR(status.st_mode) )
+      collectSources(entry,pathVect);
+    else
+    if  ( (length > 3)  &&  (entry.compare(length-3,3,".ac") == 0) )
+      pathVect.push_back(entry);
+  }
 
-  return(NULL);
+  return(true);
 }
 
 
-//  PURPOSE:  To parse zero or more variable declarations from 'tokenStream'.
-//  Returns 'NULL' as no 'Symbol' instances need to be created to declare
-//  a variable.
-Symbol* parseDeclares (TokenStream& tokenStream
-      )
+//  PURPOSE:  To return the number of threads to use by default: one per
+//  core.
+int   getDefaultNumThreads
+      ()
 {
-  if  ( (tokenStream.peek() == FLOAT_DECLARE_SYMBOL) ||
-        (tokenStream.peek() == INT_DECLARE_SYMBOL)
+  unsigned int  numCores  = std::thread::hardware_concurrency();
+
+  return( (numCores == 0) ? 1 : (int)numCores );
+}
+
+
+//  PURPOSE:  To translate each of the files, and the '.ac' files under each
+//  of the directories, in 'pathVect' to a '.dc' file beside it, on
+//  'numThreads' threads, optimizing if 'shouldOptimize'.  Reports failures
+//  and throughput on 'std::cerr'.  Returns 'EXIT_SUCCESS' if all were
+//  translated or 'EXIT_FAILURE' otherwise.
+int   translateBatch  (const std::vector<std::string>&  pathVect,
+       bool       shouldOptimize,
+       int        numThreads
       )
-  {
-    parseDeclare(tokenStream);
-    parseDeclares(tokenStream);
-  }
-  else
-  if  ( (tokenStream.peek() == ID_SYMBOL) ||
-  (tokenStream.peek() == PRINT_SYMBOL)  ||
-  (tokenStream.peek() == END_OF_FILE_SYMBOL)
+{
+  std::vector<std::string>
+      sourceVect;
+
+  for  (size_t i = 0;  i < pathVect.size();  i++)
+    if  ( !collectSources(pathVect[i],sourceVect) )
+    {
+      std::cerr << "Cannot read " << pathVect[i] << '\n';
+      return(EXIT_FAILURE);
+    }
+
+  WorkStealingPool  pool(numThreads);
+  BatchTranslator translator(sourceVect,false,shouldOptimize,
+             pool.getNumWorkers()
+            );
+  double    startTime = nowInSeconds();
+
+  pool.run(sourceVect.size(),translator);
+
+  double    batchTime = nowInSeconds() - startTime;
+  size_t    numFailed = 0;
+
+  for  (size_t i = 0;  i < sourceVect.size();  i++)
+    if  ( !translator.getError(i).empty() )
+    {
+      std::cerr << sourceVect[i] << ": " << translator.getError(i) << '\n';
+      numFailed++;
+    }
+
+  std::cerr << sourceVect.size() << " programs (" << numFailed
+      << " failed) on " << pool.getNumWorkers() << " threads in "
+      << batchTime << " s: "
+      << ((batchTime > 0) ? sourceVect.size() / batchTime : 0)
+      << " programs/s\n";
+
+  return( (numFailed == 0) ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+
+//  PURPOSE:  To time translating 'numPrograms' random programs in memory on
+//  1 to 'maxNumThreads' threads, and to report the throughput of each on
+//  'std::cerr'.  Returns 'EXIT_SUCCESS' on success or 'EXIT_FAILURE'
+//  otherwise.
+int   benchmarkBatch  (size_t numPrograms,
+       int    maxNumThreads,
+       bool   shouldOptimize
       )
+{
+  std::vector<std::string>
+      programVect;
+  double    oneThreadRate = 0;
+
+  srand(1);
+
+  for  (size_t i = 0;  i < numPrograms;  i++)
+    programVect.push_back(generateRandomProgram());
+
+  std::cerr << "threads  programs/s  speedup  steals\n";
+
+  for  (int numThreads = 1;  numThreads <= maxNumThreads;  numThreads++)
   {
-    //  lambda production
+    WorkStealingPool  pool(numThreads);
+    BatchTranslator translator(programVect,true,shouldOptimize,numThreads);
+    double    startTime = nowInSeconds();
+
+    pool.run(programVect.size(),translator);
+
+    double    rate    = numPrograms / (nowInSeconds() - startTime);
+
+    for  (size_t i = 0;  i < numPrograms;  i++)
+      if  ( !translator.getError(i).empty() )
+      {
+        std::cerr << "Program " << i << ": " << translator.getError(i)
+            << '\n';
+        return(EXIT_FAILURE);
+      }
+
+    if  (numThreads == 1)
+      oneThreadRate = rate;
+
+    fprintf(stderr,"%7d  %10.0f  %6.2fx  %6lu\n",
+      numThreads,rate,rate / oneThreadRate,
+      (unsigned long)pool.getNumSteals()
+     );
   }
-  else
-    throw "expected floatdcl, intdcl, id, print, or eof";
 
-  return(NULL);
+  return(EXIT_SUCCESS);
 }
 
 
-//  PURPOSE:  To parse and return a pointer to a 'Symbol' that represents a
-//  value from 'tokenStream'.
-Symbol* parseValue  (TokenStream& tokenStream
-      )
+
+/*  PURPOSE:  To translate one program again and again as it is edited,
+ *  redoing only the statements each edit touches.  It keeps the types of the
+ *  variables in its symbol table and, for each statement, where in the text
+ *  it starts and the 'dc' code it was translated to.  An edit is found by
+ *  comparing the new text with the old from both ends; the statements from
+ *  the one the edit starts in are then parsed, checked and output again
+ *  until the next one starts just where an old statement after the edit
+ *  now starts, and from there on the old ones are kept.  Without '-O' the
+ *  types and code of a statement depend on nothing before it but the
+ *  declarations (the values that flow between statements are only used by
+ *  the optimizer), so an edit that reaches the declarations translates the
+ *  whole program again.  Variables keep their 'dc' registers from one edit
+ *  to the next.  It also tells which statements' code changed, so that only
+ *  that part of the '.dc' file need be written again.  Finding an edit
+ *  still compares all of the text, and moving what is kept after it still
+ *  moves the rest of the text, starts and code, but at 'memcmp()' and
+ *  'memmove()' speed; the parsing, checking, output and writing done grow
+ *  with the edit.
+ */
+class IncrementalTranslator
 {
-  Symbol* symbolPtr;
+  //  0.  Internal constants and types:
+  //  PURPOSE:  To tell how many statements are parsed before they are
+  //  checked and output, and their nodes given back.
+  static
+  const
+  size_t    STATEMENTS_PER_BATCH  = 4096;
 
-  if  (tokenStream.peek() == ID_SYMBOL)
-    symbolPtr = expect(tokenStream,ID_SYMBOL);
-  else
-  if  (tokenStream.peek() == INT_SYMBOL)
-    symbolPtr = expect(tokenStream,INT_SYMBOL);
-  else
-  if  (tokenStream.peek() == FLOAT_SYMBOL)
-    symbolPtr = expect(tokenStream,FLOAT_SYMBOL);
-  else
-    throw "expected id, inum, or fnum";
+  //  I.  Member vars:
+  //  PURPOSE:  To hold the symbol table, and the syntax tree and literals of
+  //  the statements being translated.
+  TranslationState  state_;
+
+  //  PURPOSE:  To hold the 'dc' code of the statement being output, and the
+  //  registers given to the variables.
+  DcCode    dcCode_;
+
+  //  PURPOSE:  To hold the text last translated without error.
+  std::string   text_;
+
+  //  PURPOSE:  To hold, for each statement of 'text_', where its first
+  //  lexeme starts.
+  std::vector<size_t>
+      startVect_;
+
+  //  PURPOSE:  To hold, for each statement of 'text_', its 'dc' code.
+  std::vector<std::string>
+      fragmentVect_;
+
+  //  PURPOSE:  To tell if the whole text must be translated next time,
+  //  because the last try to do so failed after the types were forgotten.
+  bool      isWholeNeeded_;
+
+  //  PURPOSE:  To hold how many statements the last 'update()' translated.
+  size_t    numTranslated_;
+
+  //  PURPOSE:  To hold the statements whose 'dc' code the last 'update()'
+  //  changed: from 'firstChangedInd_' up to 'endChangedInd_', which is the
+  //  number of statements if the code after them moved.
+  size_t    firstChangedInd_;
+  size_t    endChangedInd_;
+
+  //  PURPOSE:  To hold the length of the 'dc' code of the whole program, now
+  //  and before the last 'update()'.
+  size_t    outputLength_;
+  size_t    prevOutputLength_;
+
+  //  II.  Disallowed auto-generated methods:
+  //  No copy constructor:
+  IncrementalTranslator (const IncrementalTranslator&
+        );
+
+  //  No copy assignment op:
+  IncrementalTranslator&  operator=
+      (const IncrementalTranslator&
+        );
+
+protected :
+  //  III.  Protected methods:
+  //  PURPOSE:  To return how many of the first 'length' chars from 'first'
+  //  and from 'second' are the same, stepping by 'step' (1 or -1) from
+  //  each.  Blocks of chars are compared with 'memcmp()' until one differs.
+  static
+  size_t    getNumSameChars
+      (const char*  first,
+       const char*  second,
+       size_t   length,
+       int    step
+      )
+      throw()
+      {
+        const size_t  BLOCK_SIZE  = 4096;
+        size_t    numSame   = 0;
+
+        while  (length - numSame >= BLOCK_SIZE)
+        {
+          //  The block's lowest char is 'offset' from 'first' and 'second':
+          ptrdiff_t offset  = (step > 0)
+                ? (ptrdiff_t)numSame
+                : -(ptrdiff_t)(numSame + BLOCK_SIZE - 1);
+
+          if  (memcmp(first + offset,second + offset,BLOCK_SIZE) != 0)
+            break;
+
+          numSame += BLOCK_SIZE;
+        }
+
+        while  ( (numSame < length)  &&
+           (first[step * (ptrdiff_t)numSame]
+            == second[step * (ptrdiff_t)numSame]
+           )
+         )
+          numSame++;
+
+        return(numSame);
+      }
+
+  //  PURPOSE:  To check the statements in 'statementList', to append the
+  //  'dc' code of each to 'newFragmentVect', and then to give back their
+  //  nodes and literals.  No return value.
+  void    outputStatements
+      (StatementList&     statementList,
+       std::vector<std::string>&  newFragmentVect
+      )
+      throw(const char*)
+      {
+        std::vector<NodeInd>  chainVect;
+        std::ostringstream  out;
+
+        checkConsistency(state_,statementList);
+
+        for  (size_t i = 0;  i < statementList.size();  i++)
+        {
+          dcCode_.clear();
+          outputForDC(state_,statementList[i],chainVect,dcCode_);
+          out.str("");
+          dcCode_.write(out);
+          newFragmentVect.push_back(out.str());
+        }
+
+        dcCode_.clear();
+        statementList.clear();
+        state_.tree_.rewind();
+        state_.literalPool_.clear();
+      }
+
+  //  PURPOSE:  To translate the statements from 'tokenStream', which views
+  //  'text', appending where each starts to 'newStartVect' and its 'dc' code
+  //  to 'newFragmentVect'.  Stops at the end of the text, or where the next
+  //  statement starts just where an old statement, from the one at
+  //  'keptInd' on, starts once moved by 'shift' (which may wrap around, to
+  //  move it back).  Returns the index of that old statement, or the number
+  //  of old statements if the end was reached.
+  size_t    translateStatements
+      (TokenStream&     tokenStream,
+       const std::string&   text,
+       size_t       keptInd,
+       size_t       shift,
+       std::vector<size_t>&   newStartVect,
+       std::vector<std::string>&  newFragmentVect
+      )
+      throw(const char*)
+      {
+        StatementList statementList;
+
+        while  (tokenStream.peek() != END_OF_FILE_SYMBOL)
+        {
+          size_t  start = tokenStream.getPeekedPtr() - text.data();
+
+          while  ( (keptInd < startVect_.size())  &&
+             (startVect_[keptInd] + shift < start)
+           )
+            keptInd++;
+
+          if  ( (keptInd < startVect_.size())  &&
+          (startVect_[keptInd] + shift == start)
+        )
+          {
+            outputStatements(statementList,newFragmentVect);
+            return(keptInd);
+          }
+
+          if  ( (tokenStream.peek() != ID_SYMBOL)  &&
+          (tokenStream.peek() != PRINT_SYMBOL)
+        )
+            throw "expected id, print, or eof";
+
+          newStartVect.push_back(start);
+          statementList.push_back(parseStatement(state_,tokenStream));
+
+          if  (statementList.size() == STATEMENTS_PER_BATCH)
+            outputStatements(statementList,newFragmentVect);
+        }
+
+        outputStatements(statementList,newFragmentVect);
+        return(startVect_.size());
+      }
+
+  //  PURPOSE:  To translate all of 'newText', declarations and statements,
+  //  and to keep it.  No return value.
+  void    translateWhole
+      (const std::string& newText
+      )
+      throw(const char*)
+      {
+        std::vector<size_t>   newStartVect;
+        std::vector<std::string>  newFragmentVect;
+
+        isWholeNeeded_  = true;
+        state_.tree_.rewind();
+        state_.literalPool_.clear();
+        state_.symbolTable_.clearTypes();
+        dcCode_.forgetRegisters();
+
+        InputCharStream inputCharStream(newText.data(),newText.length());
+        TokenStream tokenStream(inputCharStream,state_.literalPool_,
+              state_.symbolTable_
+             );
+
+        parseDeclares(state_,tokenStream);
+        translateStatements(tokenStream,newText,startVect_.size(),0,
+          newStartVect,newFragmentVect
+         );
+
+        text_ = newText;
+        startVect_.swap(newStartVect);
+        fragmentVect_.swap(newFragmentVect);
+        numTranslated_  = startVect_.size();
+        isWholeNeeded_  = false;
+        firstChangedInd_  = 0;
+        endChangedInd_  = startVect_.size();
+        prevOutputLength_ = outputLength_;
+        outputLength_ = 0;
+
+        for  (size_t i = 0;  i < fragmentVect_.size();  i++)
+          outputLength_ += fragmentVect_[i].length();
+      }
+
+public :
+  //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+  //  PURPOSE:  To initialize '*this' to have translated an empty program.
+  //  No parameters.
+  IncrementalTranslator ()
+      throw() :
+      dcCode_(state_.symbolTable_),
+      isWholeNeeded_(true),
+      numTranslated_(0),
+      firstChangedInd_(0),
+      endChangedInd_(0),
+      outputLength_(0),
+      prevOutputLength_(0)
+      { }
+
+  //  PURPOSE:  To release resources.  No parameters.
+  ~IncrementalTranslator  ()
+      {
+        state_.tree_.release();
+      }
+
+  //  V.  Accessors:
+  //  PURPOSE:  To return how many statements the program has.
+  size_t    getNumStatements
+      ()
+        const
+      throw()
+      { return(startVect_.size()); }
+
+  //  PURPOSE:  To return how many statements the last 'update()' translated.
+  size_t    getNumTranslated
+      ()
+        const
+      throw()
+      { return(numTranslated_); }
+
+  //  PURPOSE:  To return 'true' if the last 'update()' changed the 'dc' code,
+  //  or 'false' otherwise.
+  bool    didChange ()
+        const
+      throw()
+      { return(firstChangedInd_ < endChangedInd_); }
+
+  //  PURPOSE:  To return 'true' if the last 'update()' changed the 'dc' code
+  //  of every statement, or 'false' otherwise.
+  bool    didChangeWhole
+      ()
+        const
+      throw()
+      {
+        return( (firstChangedInd_ == 0)  &&
+          (endChangedInd_ == fragmentVect_.size())
+        );
+      }
+
+  //  PURPOSE:  To return how long the 'dc' code was before the last
+  //  'update()'.
+  size_t    getPrevOutputLength
+      ()
+        const
+      throw()
+      { return(prevOutputLength_); }
+
+  //  VI.  Mutators:
+
+  //  VII.  Methods that do main and misc work of class:
+  //  PURPOSE:  To translate the program now written as 'newText', redoing
+  //  only the statements that differ from those last translated.  If it
+  //  cannot be translated, throws why and still holds the last program
+  //  that could, which the next call is compared against.  No return value.
+  void    update  (const std::string& newText
+        )
+      throw(const char*)
+      {
+        size_t  oldLength = text_.length();
+        size_t  newLength = newText.length();
+        size_t  maxLength = std::min(oldLength,newLength);
+        size_t  prefixLength  = getNumSameChars(text_.data(),newText.data(),
+                   maxLength,1
+                  );
+        size_t  suffixLength  = getNumSameChars(text_.data() + oldLength - 1,
+                   newText.data() + newLength - 1,
+                   maxLength - prefixLength,-1
+                  );
+
+        if  ( isWholeNeeded_  ||
+        startVect_.empty()  ||
+        (prefixLength <= startVect_[0])
+      )
+        {
+          translateWhole(newText);
+          return;
+        }
 
-  return(symbolPtr);
-}
+        numTranslated_  = 0;
+        firstChangedInd_  = endChangedInd_  = 0;
+        prevOutputLength_ = outputLength_;
+
+        if  ( (prefixLength == oldLength)  &&  (prefixLength == newLength) )
+          return;
+
+        //  Start with the statement that holds the last char before the edit
+        //  (as the edit may add to it), and try to stop before the first that
+        //  starts after the first char after the edit:
+        size_t  firstInd  = std::upper_bound(startVect_.begin(),
+                     startVect_.end(),
+                     prefixLength - 1
+                    )
+                - startVect_.begin() - 1;
+        size_t  keptInd = std::upper_bound(startVect_.begin(),
+                     startVect_.end(),
+                     oldLength - suffixLength
+                    )
+                - startVect_.begin();
+        size_t  shift   = newLength - oldLength;
+        size_t  start   = startVect_[firstInd];
+        std::vector<size_t>   newStartVect;
+        std::vector<std::string>  newFragmentVect;
+
+        state_.tree_.rewind();
+        state_.literalPool_.clear();
+
+        InputCharStream inputCharStream(newText.data() + start,
+            newLength - start
+               );
+        TokenStream tokenStream(inputCharStream,state_.literalPool_,
+              state_.symbolTable_
+             );
+
+        keptInd = translateStatements(tokenStream,newText,keptInd,shift,
+              newStartVect,newFragmentVect
+             );
+
+        //  Replace the statements from 'firstInd' up to 'keptInd' (in place
+        //  as far as there are as many new ones), and move those kept after
+        //  them:
+        size_t  numNew    = newStartVect.size();
+        size_t  numSame   = std::min(numNew,keptInd - firstInd);
+        size_t  oldChangedLength  = 0;
+        size_t  newChangedLength  = 0;
+
+        for  (size_t i = firstInd;  i < keptInd;  i++)
+          oldChangedLength  += fragmentVect_[i].length();
+
+        for  (size_t i = 0;  i < numNew;  i++)
+          newChangedLength  += newFragmentVect[i].length();
+
+        for  (size_t i = 0;  i < numSame;  i++)
+        {
+          startVect_[firstInd + i]  = newStartVect[i];
+          fragmentVect_[firstInd + i].swap(newFragmentVect[i]);
+        }
 
+        startVect_.erase(startVect_.begin() + firstInd + numSame,
+             startVect_.begin() + keptInd
+            );
+        fragmentVect_.erase(fragmentVect_.begin() + firstInd + numSame,
+          fragmentVect_.begin() + keptInd
+         );
 
-//  PURPOSE:  To parse and return a pointer to a 'Symbol' that represents an
-//  expression from 'tokenStream'.
-Symbol* parseExpression (TokenStream& tokenStream
-      )
-{
-  Symbol* symbolPtr;
+        if  (shift != 0)
+          for  (size_t i = firstInd + numSame;  i < startVect_.size();  i++)
+            startVect_[i] += shift;
 
-  if  (tokenStream.peek() == ADD_SYMBOL)
-  {
-    symbolPtr       = expect(tokenStream,ADD_SYMBOL);
-    symbolPtr->value_.expression_.lhsPtr_ = parseValue(tokenStream);
-    symbolPtr->value_.expression_.rhsPtr_ = parseExpression(tokenStream);
-  }
-  else
-  if  (tokenStream.peek() == SUBTRACT_SYMBOL)
-  {
-    symbolPtr       = expect(tokenStream,SUBTRACT_SYMBOL);
-    symbolPtr->value_.expression_.lhsPtr_ = parseValue(tokenStream);
-    symbolPtr->value_.expression_.rhsPtr_ = parseExpression(tokenStream);
-  }
-  else
-  if  ( (tokenStream.peek() == ID_SYMBOL) ||
-  (tokenStream.peek() == PRINT_SYMBOL)  ||
-  (tokenStream.peek() == END_OF_FILE_SYMBOL)
-      )
-  {
-    // Do nothing for lambda-production
-    symbolPtr         = NULL;
-  }
-  else
-    throw "expected plus, minus, id, print, or eof";
+        startVect_.insert(startVect_.begin() + firstInd + numSame,
+              newStartVect.begin() + numSame,newStartVect.end()
+             );
+        fragmentVect_.insert(fragmentVect_.begin() + firstInd + numSame,
+           std::make_move_iterator(newFragmentVect.begin() + numSame),
+           std::make_move_iterator(newFragmentVect.end())
+          );
+        text_.replace(prefixLength,oldLength - suffixLength - prefixLength,
+          newText,prefixLength,newLength - suffixLength - prefixLength
+         );
+        numTranslated_  = numNew;
+        outputLength_ += newChangedLength - oldChangedLength;
+        firstChangedInd_  = firstInd;
+        endChangedInd_  = (newChangedLength == oldChangedLength)
+              ? firstInd + numNew
+              : fragmentVect_.size();
+      }
 
-  return(symbolPtr);
-}
+  //  PURPOSE:  To write the 'dc' code of the program to 'out'.  No return
+  //  value.
+  void    write (std::ostream&  out
+        )
+        const
+      {
+        for  (size_t i = 0;  i < fragmentVect_.size();  i++)
+          out << fragmentVect_[i];
 
+        out.flush();
+      }
 
-//  PURPOSE:  To parse and return a pointer to a 'Symbol' that represents a
-//  statement from 'tokenStream'.
-Symbol* parseStatement  (TokenStream& tokenStream
+  //  PURPOSE:  To write the 'dc' code that the last 'update()' changed to the
+  //  file open as 'fd', which must hold the code as it was before, in place,
+  //  and to cut the file to the new length if the code after it moved.  Its
+  //  place is found by adding up the lengths of the code before it.  No
+  //  return value.
+  void    writeChanges
+      (int    fd
       )
-{
-  Symbol* symbolPtr;
+        const
+      throw(const char*)
+      {
+        size_t    offset  = 0;
+        std::string changed;
 
-  if  (tokenStream.peek() == ID_SYMBOL)
-  {
-    Symbol* varPtr  = expect(tokenStream,ID_SYMBOL);
+        for  (size_t i = 0;  i < firstChangedInd_;  i++)
+          offset  += fragmentVect_[i].length();
 
-    symbolPtr   = expect(tokenStream,ASSIGN_SYMBOL);
-    symbolPtr->value_.assignment_.varPtr_ = varPtr;
-    symbolPtr->value_.assignment_.lhsPtr_ = parseValue(tokenStream);
-    symbolPtr->value_.assignment_.rhsPtr_ = parseExpression(tokenStream);
-  }
-  else
-  if  (tokenStream.peek() == PRINT_SYMBOL)
-  {
-    symbolPtr         = expect(tokenStream,PRINT_SYMBOL);
-    symbolPtr->value_.expression_.lhsPtr_ = expect(tokenStream,ID_SYMBOL);
-  }
-  else
-    throw "expected id or print";
+        for  (size_t i = firstChangedInd_;  i < endChangedInd_;  i++)
+          changed += fragmentVect_[i];
 
-  return(symbolPtr);
-}
+        if  ( (pwrite(fd,changed.data(),changed.length(),offset)
+                != (ssize_t)changed.length()
+              )  ||
+        ( (endChangedInd_ == fragmentVect_.size())  &&
+          (ftruncate(fd,outputLength_) != 0)
+        )
+      )
+          throw "Cannot write output";
+      }
+
+};
 
 
-//  PURPOSE:  To parse and return a pointer to a 'Symbol' that represents zero
-//  or more statements from 'tokenStream'.
-Symbol* parseStatements (TokenStream& tokenStream
+//  PURPOSE:  To read all of the file at 'path' into 'text'.  Returns 'true'
+//  on success or 'false' otherwise.
+bool  readWholeFile (const char*  path,
+       std::string& text
       )
 {
-  Symbol* symbolPtr;
-
-  if  (tokenStream.peek() == ID_SYMBOL || tokenStream.peek() == PRINT_SYMBOL)
-  {
-    symbolPtr = (Symbol*)malloc(sizeof(Symbol));
+  FILE*   filePtr = fopen(path,"r");
 
-    symbolPtr->symbol_      = STATEMENT_LIST_SYMBOL;
-    symbolPtr->value_.statement_.firstPtr_
-          = parseStatement(tokenStream);
-    symbolPtr->value_.statement_.restPtr_
-          = parseStatements(tokenStream);
-  }
-  else
-  if (tokenStream.peek() == END_OF_FILE_SYMBOL)
-  {
-    // Do nothing for lambda-production
-    symbolPtr = &endSymbol;
-  }
-  else
-    throw "expected id, print, or eof";
+  if  (filePtr == NULL)
+    return(false);
 
-  return(symbolPtr);
-}
+  char    buffer[64 * 1024];
+  size_t  numRead;
 
+  text.clear();
 
-//  PURPOSE:  To parse and return a pointer to a 'Symbol' that a whole program
-//  from 'tokenStream'.
-Symbol* parseProg (TokenStream& tokenStream
-      )
-{
-  Symbol* symbolPtr;
+  while  ( (numRead = fread(buffer,1,sizeof(buffer),filePtr)) > 0 )
+    text.append(buffer,numRead);
 
-  if  ( (tokenStream.peek() == FLOAT_DECLARE_SYMBOL)  ||
-  (tokenStream.peek() == INT_DECLARE_SYMBOL)  ||
-  (tokenStream.peek() == ID_SYMBOL)   ||
-  (tokenStream.peek() == PRINT_SYMBOL)    ||
-  (tokenStream.peek() == END_OF_FILE_SYMBOL)
-      )
-  {
-        parseDeclares(tokenStream);
-  symbolPtr = parseStatements(tokenStream);
-        expect(tokenStream,END_OF_FILE_SYMBOL);
-  }
-  else
-    throw "expected floatdcl, intdcl, id, print, or eof";
+  bool    isOk  = (ferror(filePtr) == 0);
 
-  return(symbolPtr);
+  fclose(filePtr);
+  return(isOk);
 }
 
 
-
-/*---*
- *---*    Functions used to process the parse tree after parsing:
- *---*/
-
-//  PURPOSE:  To return the more general type among 'first' or 'second'.
-dcType_t
-  generalize  (dcType_t first,
-       dcType_t second
+//  PURPOSE:  To translate the '.ac' file at 'path' to a '.dc' file beside
+//  it, and then again each time the file changes, redoing only the
+//  statements each edit touches and writing only the code that changed in
+//  place (the whole '.dc' file is replaced only when all of it changed, or
+//  when it is not as last written).  Polls the file every 'WATCH_POLL_MS'
+//  milliseconds, and reports each translation, or why it failed, on
+//  'std::cerr'; a program that fails leaves the last '.dc' file that was
+//  written.  Only returns (with 'EXIT_FAILURE') if the file cannot be read
+//  at first.
+int   watchFile (const char*  path
       )
-      throw()
 {
-  return( ( (first == FLOAT_POINT_DC_TYPE) || (second == FLOAT_POINT_DC_TYPE) )
-    ? FLOAT_POINT_DC_TYPE
-    : INTEGER_DC_TYPE
-  );
-}
+  const int   WATCH_POLL_MS = 100;
+  std::string   outputPath  = BatchTranslator::getOutputPath(path);
+  std::string   tempPath  = outputPath + ".tmp";
+  IncrementalTranslator translator;
+  std::string   text;
+  struct stat   lastStatus;
 
+  memset(&lastStatus,0,sizeof(lastStatus));
 
-dcType_t
-  getType   (Symbol*  symbolPtr
-      )
-      throw(const char*);
+  for  (bool isFirst = true; ;  isFirst = false)
+  {
+    struct stat status;
+
+    if  ( (stat(path,&status) != 0)  ||
+    ( !isFirst  &&
+      (status.st_ino == lastStatus.st_ino)  &&
+      (status.st_size == lastStatus.st_size)  &&
+      (status.st_mtim.tv_sec == lastStatus.st_mtim.tv_sec)  &&
+      (status.st_mtim.tv_nsec == lastStatus.st_mtim.tv_nsec)
+    )  ||
+    !readWholeFile(path,text)
+        )
+    {
+      if  (isFirst)
+      {
+        std::cerr << "Cannot read " << path << '\n';
+        return(EXIT_FAILURE);
+      }
 
+      usleep(WATCH_POLL_MS * 1000);
+      continue;
+    }
 
-//  PURPOSE:  To return a node that casts '*symbolPtr' to type 'desiredType',
-//  if it is needed.  Just returns 'symbolPtr' if not needed.
-Symbol* convert   (Symbol*  symbolPtr,
-       dcType_t desiredType
-      )
-      throw(const char*)
-{
-  if  ( (getType(symbolPtr) == FLOAT_POINT_DC_TYPE) &&
-  (desiredType      == INTEGER_DC_TYPE)
-      ){
-      snprintf(errorMessage,256,"Type mismatch %u", symbolPtr->symbol_);
-      throw errorMessage;
-      //throw "Type mismatch"
-  }
-    ;
+    lastStatus  = status;
 
-  Symbol* toReturn  = symbolPtr;
+    try
+    {
+      double  startTime = nowInSeconds();
 
-  if  ( (getType(symbolPtr) == INTEGER_DC_TYPE) &&
-  (desiredType      == FLOAT_POINT_DC_TYPE)
-      )
-  {
-    toReturn         = (Symbol*)malloc(sizeof(Symbol));
-    toReturn->symbol_      = TYPE_CONVERT_SYMBOL;
-    toReturn->value_.expression_.lhsPtr_ = symbolPtr;
-  }
+      translator.update(text);
 
-  return(toReturn);
-}
+      double  translateTime = nowInSeconds() - startTime;
 
+      int   fd  = -1;
+      struct stat outputStatus;
 
-//  PURPOSE:  To return the type of the value or expression represented by
-//  'symbolPtr'.  Checks and adds conversion Symbol instances as needed. 
-dcType_t
-  getType   (Symbol*  symbolPtr
-      )
-      throw(const char*)
-{
-  if  (symbolPtr == NULL)
-    return(NULL_DC_TYPE);
+      if  ( !isFirst  &&
+      translator.didChange()  &&
+      !translator.didChangeWhole()  &&
+      ( (fd = open(outputPath.c_str(),O_WRONLY)) >= 0 )  &&
+      (fstat(fd,&outputStatus) == 0)  &&
+      ((size_t)outputStatus.st_size == translator.getPrevOutputLength())
+          )
+      {
+        try
+        {
+          translator.writeChanges(fd);
+        }
+        catch  (const char* cPtr
+         )
+        {
+          close(fd);
+          throw;
+        }
 
-  switch  (symbolPtr->symbol_)
-  {
-  case INT_SYMBOL :
-    return(INTEGER_DC_TYPE);
+        close(fd);
+      }
+      else
+      if  ( isFirst  ||  translator.didChange() )
+      {
+        if  (fd >= 0)
+          close(fd);
 
-  case FLOAT_SYMBOL :
-  case TYPE_CONVERT_SYMBOL :
-    return(FLOAT_POINT_DC_TYPE);
+        std::ofstream out(tempPath.c_str());
 
-  case ID_SYMBOL :
-    return(symbolTable.lookUp(symbolPtr->value_.varName_));
+        translator.write(out);
+        out.close();
 
-  case ADD_SYMBOL :
-  case SUBTRACT_SYMBOL :
-    {
-      dcType_t  newType =
-          generalize(getType(symbolPtr->value_.expression_.lhsPtr_),
-         getType(symbolPtr->value_.expression_.rhsPtr_)
-        );
+        if  ( !out  ||  (rename(tempPath.c_str(),outputPath.c_str()) != 0) )
+        {
+          remove(tempPath.c_str());
+          throw "Cannot write output";
+        }
+      }
 
-      symbolPtr->value_.expression_.lhsPtr_
-      = convert(symbolPtr->value_.expression_.lhsPtr_,
-          newType
-         );
-      symbolPtr->value_.expression_.rhsPtr_
-      = convert(symbolPtr->value_.expression_.rhsPtr_,
-          newType
-         );
-      return(newType);
+      fprintf(stderr,"%s: %lu statements, %lu translated in %.3f ms,"
+          " written in %.3f ms\n",
+        path,(unsigned long)translator.getNumStatements(),
+        (unsigned long)translator.getNumTranslated(),translateTime * 1e3,
+        (nowInSeconds() - startTime - translateTime) * 1e3
+       );
+    }
+    catch  (const char* cPtr
+     )
+    {
+      std::cerr << path << ": " << cPtr << '\n';
     }
-
-  case ASSIGN_SYMBOL :
-  case PRINT_SYMBOL :
-  case STATEMENT_LIST_SYMBOL :
-    return(NULL_DC_TYPE);
   }
 }
 
 
-//  PURPOSE:  To check the consistency (e.g. between expected and given type)
-//  at '*symbolPtr' and below.  No return value.
-void  checkConsistency(Symbol*  symbolPtr
+//  PURPOSE:  To time translating a generated program of size 'size' with
+//  an 'IncrementalTranslator', and then translating it again after each of
+//  a series of random one-line edits (changing a number, copying a
+//  statement and removing one), checking each time that the 'dc' code, and
+//  a file kept up to date by writing only what changed, are what
+//  translating the edited program anew gives.  Reports the times on
+//  'std::cerr'.  Returns 'EXIT_SUCCESS' on success or 'EXIT_FAILURE'
+//  otherwise.
+int   benchmarkWatch  (size_t size
       )
-      throw(const char*)
 {
-  if  (symbolPtr == NULL)
-    return;
+  const int   NUM_EDITS = 60;
+  const char* INDENT    = "        ";
+  std::string   program = generateShapedProgram("padded",size);
+  IncrementalTranslator translator;
+  double    totalTime = 0;
+  double    maxTime   = 0;
+  double    totalWriteTime  = 0;
+  size_t    totalNumTranslated  = 0;
+  FILE*     outputPtr = tmpfile();
+
+  srand(1);
 
-  switch  (symbolPtr->symbol_)
+  try
   {
-  case END_OF_FILE_SYMBOL :
-    break;
+    if  (outputPtr == NULL)
+      throw "Cannot make a temporary file";
 
-  case INT_SYMBOL :
-  case FLOAT_SYMBOL :
-  case ID_SYMBOL :
-    break;
+    int   fd    = fileno(outputPtr);
+    double  startTime = nowInSeconds();
 
-  case ADD_SYMBOL :
-  case SUBTRACT_SYMBOL :
-    getType(symbolPtr);
-    break;
+    translator.update(program);
 
-  case PRINT_SYMBOL :
-    break;
+    double  wholeTime = nowInSeconds() - startTime;
 
-  case ASSIGN_SYMBOL :
-    symbolPtr->value_.assignment_.lhsPtr_
-      = convert(symbolPtr->value_.assignment_.lhsPtr_,
-          getType(symbolPtr->value_.assignment_.varPtr_)
-         );
-    break;
+    translator.writeChanges(fd);
 
-  case STATEMENT_LIST_SYMBOL :
-    checkConsistency(symbolPtr->value_.statement_.firstPtr_);
-    checkConsistency(symbolPtr->value_.statement_.restPtr_);
-    break;
-  }
+    for  (int editInd = 0;  editInd < NUM_EDITS;  editInd++)
+    {
+      size_t  lineStart;
+      size_t  lineEnd;
 
-}
+      //  Pick an assignment, one a line:
+      do
+      {
+        lineStart = program.rfind('\n',rand() % program.length());
+        lineStart = (lineStart == std::string::npos) ? 0 : lineStart + 1;
+        lineEnd   = program.find('\n',lineStart);
+      }
+      while  ( (lineEnd == std::string::npos)  ||
+         (program.compare(lineStart,strlen(INDENT),INDENT) != 0)  ||
+         (program.find('=',lineStart) > lineEnd)
+       );
 
+      lineEnd++;
 
-//  PURPOSE:  To output the 'dc' code that implements the program at
-//  '*symbolPtr'.  No return value.
-void  outputForDC (Symbol*  symbolPtr
-      )
-{
-  if  (symbolPtr == NULL)
-    return;
+      switch  (editInd % 3)
+      {
+      case 0 :
+        program[program.find_first_of("123456789",lineStart)]
+          = '1' + rand() % 9;
+        break;
+
+      case 1 :
+        program.insert(lineEnd,program,lineStart,lineEnd - lineStart);
+        break;
+
+      case 2 :
+        program.erase(lineStart,lineEnd - lineStart);
+        break;
+      }
 
-  switch  (symbolPtr->symbol_)
-  {
-  case INT_SYMBOL :
-    std::cout << symbolPtr->value_.integer_ << std::endl;
-    break;
+      startTime = nowInSeconds();
+      translator.update(program);
 
-  case FLOAT_SYMBOL :
-    std::cout << symbolPtr->value_.floatPt_ << std::endl;
-    break;
+      double  time  = nowInSeconds() - startTime;
 
-  case ID_SYMBOL :
-    std::cout << "l" << symbolPtr->value_.varName_ << std::endl;
-    break;
+      totalTime += time;
+      maxTime = std::max(maxTime,time);
+      totalNumTranslated  += translator.getNumTranslated();
 
-  case ADD_SYMBOL :
-    outputForDC(symbolPtr->value_.expression_.rhsPtr_);
-    outputForDC(symbolPtr->value_.expression_.lhsPtr_);
-    std::cout << "+" << std::endl;
-    break;
+      startTime = nowInSeconds();
+      translator.writeChanges(fd);
+      totalWriteTime  += nowInSeconds() - startTime;
 
-  case SUBTRACT_SYMBOL :
-    outputForDC(symbolPtr->value_.expression_.rhsPtr_);
-    outputForDC(symbolPtr->value_.expression_.lhsPtr_);
-    std::cout << "-" << std::endl;
-    break;
+      //  Check against translating it anew:
+      TranslationState  state;
+      TranslationStats  stats = { 0, 0, 0, 0, 0 };
+      InputCharStream inputCharStream(program);
+      TokenStream tokenStream(inputCharStream,state.literalPool_,
+            state.symbolTable_
+           );
+      std::ostringstream  wholeOut;
+      std::ostringstream  editedOut;
 
-  case PRINT_SYMBOL :
-    std::cout << "l" << symbolPtr->value_.expression_.lhsPtr_->value_.varName_
-        << std::endl;
-    std::cout << "p" << std::endl;
-    std::cout << "si" << std::endl;
-    break;
+      translateProg(state,tokenStream,false,NULL,NULL,wholeOut,stats);
+      state.tree_.release();
+      translator.write(editedOut);
 
-  case ASSIGN_SYMBOL :
-    outputForDC(symbolPtr->value_.assignment_.lhsPtr_);
-    outputForDC(symbolPtr->value_.assignment_.rhsPtr_);
-    std::cout << "s" << symbolPtr->value_.assignment_.varPtr_->value_.varName_
-        << std::endl;
-    std::cout << "0 k" << std::endl;
-    break;
+      if  (wholeOut.str() != editedOut.str())
+        throw "Edited translation differs from a new one";
 
-  case STATEMENT_LIST_SYMBOL :
-    outputForDC(symbolPtr->value_.statement_.firstPtr_);
-    outputForDC(symbolPtr->value_.statement_.restPtr_);
-    break;
+      struct stat fileStatus;
+      std::string fileText;
 
-  case TYPE_CONVERT_SYMBOL :
-    outputForDC(symbolPtr->value_.expression_.lhsPtr_);
-    std::cout << "5 k" << std::endl;
-    break;
-  }
+      if  (fstat(fd,&fileStatus) != 0)
+        throw "Cannot read the temporary file";
 
-}
+      fileText.resize(fileStatus.st_size);
 
+      if  ( pread(fd,&fileText[0],fileText.length(),0)
+      != (ssize_t)fileText.length()
+          )
+        throw "Cannot read the temporary file";
 
-//  PURPOSE:  To recursively 'free()' the memory at 'symbolPtr' and below.
-//  No return value.
-void  recursivelyFree (Symbol*  symbolPtr
-      )
-{
-  if  ( (symbolPtr == NULL)  ||  (symbolPtr == &endSymbol) )
-    return;
+      if  (fileText != wholeOut.str())
+        throw "Written changes differ from a new translation";
+    }
 
-  switch  (symbolPtr->symbol_)
+    fprintf(stderr,"%lu statements (%lu bytes): whole %.3f ms; %d edits:"
+        " mean %.3f ms, max %.3f ms, mean %.1f statements translated,"
+        " mean %.3f ms written\n",
+      (unsigned long)translator.getNumStatements(),
+      (unsigned long)program.length(),wholeTime * 1e3,NUM_EDITS,
+      totalTime / NUM_EDITS * 1e3,maxTime * 1e3,
+      (double)totalNumTranslated / NUM_EDITS,
+      totalWriteTime / NUM_EDITS * 1e3
+     );
+  }
+  catch  (const char* cPtr
+   )
   {
-  case INT_SYMBOL :
-  case FLOAT_SYMBOL :
-  case ID_SYMBOL :
-    break;
-
-  case ADD_SYMBOL :
-  case SUBTRACT_SYMBOL :
-    recursivelyFree(symbolPtr->value_.expression_.lhsPtr_);
-    recursivelyFree(symbolPtr->value_.expression_.rhsPtr_);
-    break;
-
-  case PRINT_SYMBOL :
-    recursivelyFree(symbolPtr->value_.expression_.lhsPtr_);
-    break;
+    std::cerr << cPtr << '\n';
 
-  case ASSIGN_SYMBOL :
-    recursivelyFree(symbolPtr->value_.assignment_.rhsPtr_);
-    recursivelyFree(symbolPtr->value_.assignment_.lhsPtr_);
-    recursivelyFree(symbolPtr->value_.assignment_.varPtr_);
-    break;
+    if  (outputPtr != NULL)
+      fclose(outputPtr);
 
-  case STATEMENT_LIST_SYMBOL :
-    recursivelyFree(symbolPtr->value_.statement_.restPtr_);
-    recursivelyFree(symbolPtr->value_.statement_.firstPtr_);
-    break;
+    return(EXIT_FAILURE);
   }
 
-  free(symbolPtr);
+  fclose(outputPtr);
+  return(EXIT_SUCCESS);
 }
 
 
-
 /*---*
  *---*    Functions used to interact with the user:
  *---*/
@@ -952,29 +6527,189 @@ std::string
 }
 
 
-//  PURPOSE:  To run the AC to DC conversion program.  Uses 'argv[1]' as input
-//  if 'argc' > 1.  Returns 'EXIT_SUCCESS' on success or 'EXIT_FAILURE'
-//  otherwise.
+//  PURPOSE:  To run the AC to DC conversion program.  Options come first:
+//  "--stats" reports allocator use, what the optimizer did and instruction
+//  counts on 'stderr', "-O" propagates values, folds constants, removes
+//  dead stores and runs the peephole optimizer over the 'dc' code, "--run"
+//  runs the program in-process instead of writing 'dc' code, "--native" runs
+//  it as native code, "--bench-run N" times both against piping to 'dc' for
+//  a generated N-statement program, "--check-native N" checks native code
+//  against "--run" on N random programs, "--bench-digits D" times running a
+//  program on D-digit literals, and "-f file" reads the program from 'file',
+//  mapped into memory if it is a regular file, or else in chunks ("-" means
+//  'stdin').  "--batch" translates each file (or each
+//  '.ac' file under each directory) named by the non-option arguments to a
+//  '.dc' file beside it, on "-j N" threads (default one per core), and
+//  "--bench-batch N" reports the throughput of translating N random
+//  programs on 1 to that many threads.  "--bench-phases N" times each phase
+//  on generated programs of several shapes and size N ("--json" before it
+//  reports as JSON).  "--bench-scan N" reports the MB/s the scanner
+//  tokenizes with and without SIMD skipping, and "--stress N" checks that
+//  translating generated programs of up to N statements (say 1000000) takes
+//  linear time and bounded memory.  "--watch file" translates
+//  'file' to a '.dc' file beside it and again, a statement at a time, each
+//  time it is edited (without "-O"), and "--bench-watch N" times that for
+//  edits to a generated program of size N.  Otherwise uses the first
+//  non-option argument as input if there is one.  Returns 'EXIT_SUCCESS' on
+//  success or 'EXIT_FAILURE' otherwise.
 int main    (int    argc,
        char*    argv[]
       )
 {
   endSymbol.symbol_   = END_OF_FILE_SYMBOL;
-  Symbol* symbolPtr = NULL;
   int   status    = EXIT_SUCCESS;
-  std::string input   = (argc > 1)
-          ? std::string(argv[1])
+  bool    shouldReportStats = false;
+  bool    shouldOptimize  = false;
+  bool    shouldRun = false;
+  bool    shouldRunNatively = false;
+  bool    isBatch   = false;
+  bool    isWatch   = false;
+  bool    shouldWriteJson = false;
+  int   numThreads  = getDefaultNumThreads();
+  TranslationState  state;
+  TranslationStats  stats = { 0, 0, 0, 0, 0 };
+  const char* fileName  = NULL;
+  int   argInd    = 1;
+
+  for  ( ;  (argInd < argc) && (argv[argInd][0] == '-');  argInd++)
+  {
+    if  (strcmp(argv[argInd],"--stats") == 0)
+      shouldReportStats = true;
+    else
+    if  (strcmp(argv[argInd],"-O") == 0)
+      shouldOptimize  = true;
+    else
+    if  (strcmp(argv[argInd],"--run") == 0)
+      shouldRun = true;
+    else
+    if  (strcmp(argv[argInd],"--native") == 0)
+      shouldRunNatively = true;
+    else
+    if  ( (strcmp(argv[argInd],"--bench-run") == 0)  &&  (argInd+1 < argc) )
+      return(benchmarkRun(strtoul(argv[argInd+1],NULL,10)));
+    else
+    if  ( (strcmp(argv[argInd],"--bench-digits") == 0)  &&  (argInd+1 < argc) )
+      return(benchmarkDigits(strtoul(argv[argInd+1],NULL,10),1000));
+    else
+    if  ( (strcmp(argv[argInd],"--check-native") == 0)  &&  (argInd+1 < argc) )
+      return(checkNative(strtoul(argv[argInd+1],NULL,10)));
+    else
+    if  ( (strcmp(argv[argInd],"-f") == 0)  &&  (argInd+1 < argc) )
+      fileName  = argv[++argInd];
+    else
+    if  (strcmp(argv[argInd],"--batch") == 0)
+      isBatch = true;
+    else
+    if  (strcmp(argv[argInd],"--watch") == 0)
+      isWatch = true;
+    else
+    if  ( (strcmp(argv[argInd],"--bench-watch") == 0)  &&  (argInd+1 < argc) )
+      return(benchmarkWatch(strtoul(argv[argInd+1],NULL,10)));
+    else
+    if  (strcmp(argv[argInd],"--json") == 0)
+      shouldWriteJson = true;
+    else
+    if  ( (strcmp(argv[argInd],"--bench-phases") == 0)  &&  (argInd+1 < argc) )
+      return(benchmarkPhases(strtoul(argv[argInd+1],NULL,10),shouldWriteJson));
+    else
+    if  ( (strcmp(argv[argInd],"--bench-scan") == 0)  &&  (argInd+1 < argc) )
+      return(benchmarkScan(strtoul(argv[argInd+1],NULL,10)));
+    else
+    if  ( (strcmp(argv[argInd],"--stress") == 0)  &&  (argInd+1 < argc) )
+      return(stressTranslate(strtoul(argv[argInd+1],NULL,10)));
+    else
+    if  ( (strcmp(argv[argInd],"-j") == 0)  &&  (argInd+1 < argc) )
+      numThreads  = atoi(argv[++argInd]);
+    else
+    if  ( (strcmp(argv[argInd],"--bench-batch") == 0)  &&  (argInd+1 < argc) )
+      return(benchmarkBatch(strtoul(argv[argInd+1],NULL,10),numThreads,
+          shouldOptimize
+         )
+        );
+    else
+    {
+      std::cerr << "Unknown option " << argv[argInd] << '\n';
+      return(EXIT_FAILURE);
+    }
+  }
+
+  if  (isBatch)
+    return(translateBatch(std::vector<std::string>(argv + argInd,argv + argc),
+        shouldOptimize,numThreads
+             )
+    );
+
+  if  (isWatch)
+  {
+    if  ( shouldOptimize  ||  (argInd >= argc) )
+    {
+      std::cerr << "--watch needs a file, and cannot optimize\n";
+      return(EXIT_FAILURE);
+    }
+
+    return(watchFile(argv[argInd]));
+  }
+
+  std::string input;
+  FILE*   filePtr   = NULL;
+  MappedFile* mappedFilePtr = NULL;
+  InputCharStream*
+    inputCharStreamPtr;
+
+  if  ( (fileName != NULL)  &&
+  (strcmp(fileName,"-") != 0)  &&
+  MappedFile::canMap(fileName)
+      )
+  {
+    try
+    {
+      mappedFilePtr = new MappedFile(fileName);
+    }
+    catch  (const char* cPtr
+     )
+    {
+      std::cerr << cPtr << '\n';
+      return(EXIT_FAILURE);
+    }
+
+    inputCharStreamPtr  = new InputCharStream(*mappedFilePtr);
+  }
+  else
+  if  (fileName != NULL)
+  {
+    filePtr = (strcmp(fileName,"-") == 0) ? stdin : fopen(fileName,"r");
+
+    if  (filePtr == NULL)
+    {
+      std::cerr << "Cannot open " << fileName << '\n';
+      return(EXIT_FAILURE);
+    }
+
+    inputCharStreamPtr  = new InputCharStream(filePtr);
+  }
+  else
+  {
+    input   = (argInd < argc)
+          ? std::string(argv[argInd])
           : userStdInInput();
-  InputCharStream
-    inputCharStream(input);
-  TokenStream tokenStream(inputCharStream);
+    inputCharStreamPtr  = new InputCharStream(input);
+  }
 
   try
   {
-    symbolPtr = parseProg(tokenStream);
-    checkConsistency(symbolPtr);
-    outputForDC(symbolPtr);
-    recursivelyFree(symbolPtr);
+    TokenStream tokenStream(*inputCharStreamPtr,state.literalPool_,
+          state.symbolTable_
+         );
+    DcMachine machine(std::cout);
+    NativeMachine native(state.symbolTable_,state.tree_,state.literalPool_,
+           std::cout
+          );
+
+    translateProg(state,tokenStream,shouldOptimize,
+        shouldRun ? &machine : NULL,
+        shouldRunNatively ? &native : NULL,
+        std::cout,stats
+       );
   }
   catch  (const char* cPtr
    )
@@ -983,5 +6718,27 @@ int main    (int    argc,
     status  = EXIT_FAILURE;
   }
 
+  if  (shouldReportStats)
+  {
+    std::cerr << "Tree nodes: " << state.tree_.getNumNodes()
+        << " of " << SyntaxTree::BYTES_PER_NODE << " bytes, peak bytes: "
+        << state.tree_.getPeakNumBytes() << '\n';
+    std::cerr << "Values propagated: " << stats.numValuesPropagated_
+        << ", dead statements removed: " << stats.numStatementsRemoved_
+        << '\n';
+    std::cerr << "Nodes removed by folding: " << stats.numNodesFolded_
+        << '\n';
+    std::cerr << "dc instructions: " << stats.numInstructionsBefore_
+        << " before optimizing, " << stats.numInstructionsAfter_
+        << " after" << '\n';
+  }
+
+  state.tree_.release();
+  delete(inputCharStreamPtr);
+  delete(mappedFilePtr);
+
+  if  ( (filePtr != NULL) && (filePtr != stdin) )
+    fclose(filePtr);
+
   return(status);
-}
\ No newline at end of file
+}
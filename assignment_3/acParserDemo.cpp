@@ -0,0 +1,58 @@
+/*-------------------------------------------------------------------------*
+ *---									---*
+ *---		acParserDemo.cpp					---*
+ *---									---*
+ *---	    This file uses the parser that llParserMaker generates for	---*
+ *---	the "AC" grammar (see 'ac.grammar' and the Makefile) to parse	---*
+ *---	each line of the standard input.				---*
+ *---									---*
+ *-------------------------------------------------------------------------*/
+
+#include	<cstdlib>
+#include	<iostream>
+#include	"acParser.h"
+
+
+//  PURPOSE:  To show that the table is there at compile time: a declaration
+//	that begins with "float" is done by production 3, "Dcl - float id".
+static_assert(acParser::lookup(acParser::N_Dcl,acParser::T_float) == 3,
+	      "Unexpected table for the AC grammar"
+	     );
+
+
+//  PURPOSE:  To parse each line of the standard input as an "AC" program,
+//	and to say whether it is one.  Returns 'EXIT_SUCCESS' if all are, or
+//	'EXIT_FAILURE' otherwise.
+int		main	()
+{
+  std::string	line;
+  int		status	= EXIT_SUCCESS;
+
+  while  ( std::getline(std::cin,line) )
+  {
+    std::vector<uint16_t>	tokens;
+    std::vector<uint16_t>	derivation;
+
+    if  ( !acParser::tokenize(line,tokens) )
+    {
+      std::cout << "Undeclared symbol in input." << std::endl;
+      status	= EXIT_FAILURE;
+      continue;
+    }
+
+    long	errorIndex	= acParser::parse(tokens,&derivation);
+
+    if  (errorIndex < 0)
+      std::cout << "Parse completed in " << derivation.size()
+		<< " productions." << std::endl;
+    else
+    {
+      std::cout << "Syntax error at token " << errorIndex << " ("
+		<< acParser::SYMBOL_NAMES[tokens[errorIndex]] << ")."
+		<< std::endl;
+      status	= EXIT_FAILURE;
+    }
+  }
+
+  return(status);
+}
@@ -23,11 +23,18 @@
 #include	<cstdlib>
 #include	<cstdio>
 #include	<cstring>
+#include	<cstdint>
 #include	<string>
 #include	<iostream>
+#include	<algorithm>
 #include	<map>
+#include	<unordered_map>
 #include	<vector>
-#include	<set>
+#include	<sys/time.h>
+#include	<sys/stat.h>
+#include	<sys/mman.h>
+#include	<fcntl.h>
+#include	<unistd.h>
 
 
 //	----	----	----	----	----	----	----	----	//
@@ -61,6 +68,26 @@ const char	PROD_ARROW_CHAR		= '-';
 //  PURPOSE:  To tell how big 'text[]' is.
 const int	TEXT_LEN		= 256;
 
+//  PURPOSE:  To hold the "AC" grammar (Grammar #6 at the end of this file),
+//	which the benchmarks use as a real grammar.
+const char	AC_GRAMMAR[]		=
+"{float,int,id,=,print,+},{Prog,Dcls,Dcl,Stmts,Stmt,Expr,Val},Prog,"
+"{Prog - Dcls Stmts,Dcls - Dcl Dcls, Dcls - ,Dcl - float id, "
+"Dcl - int id, Stmts - Stmt Stmts, Stmts - , "
+"Stmt - id = Val Expr, Stmt - print id, Expr - + Val Expr, "
+"Expr - , Val - id, Val - #i , Val - #f}";
+
+//  PURPOSE:  To mark a slot of the packed LL(1) table that no row uses.  Also
+//	one more than the most rows and Production instances the table holds.
+const uint16_t	NO_TABLE_ROW		= 0xFFFF;
+
+//  PURPOSE:  To begin every file that holds a built Grammar.
+const char	GRAMMAR_FILE_MAGIC[]	= "LLPG";
+
+//  PURPOSE:  To tell the format of files that hold a built Grammar.  Must be
+//	increased whenever that format changes.
+const uint32_t	GRAMMAR_FILE_VERSION	= 1;
+
 
 //	----	----	----	----	----	----	----	----	//
 //									//
@@ -101,6 +128,25 @@ throw()
 }
 
 
+//  PURPOSE:  To return the 64-bit FNV-1a hash of the 'length' bytes at
+//	'bytePtr'.
+uint64_t	computeHash	(const char*	bytePtr,
+                         size_t		length
+                         )
+throw()
+{
+    uint64_t	hash	= 0xcbf29ce484222325ULL;
+    
+    for  (size_t i = 0;  i < length;  i++)
+    {
+        hash	^= (unsigned char)bytePtr[i];
+        hash	*= 0x100000001b3ULL;
+    }
+    
+    return(hash);
+}
+
+
 //	----	----	----	----	----	----	----	----	//
 //									//
 //    Definitions of classes that implement the components of Grammar:	//
@@ -111,6 +157,108 @@ class		NonTerminal;
 
 class		Grammar;
 
+//  PURPOSE:  To implement a set of Terminal instances as a bitset indexed by
+//	their identity integers (which run from 0 up, before those of the
+//	NonTerminal instances).  Taking the union of two sets is a loop of
+//	word-wide ORs.
+class		TerminalSet
+{
+    //  I.  Member vars:
+    //  PURPOSE:  To tell how many bits each word of 'wordVect_' holds.
+    static
+    const uInt		BITS_PER_WORD	= 8 * sizeof(unsigned long);
+    
+    //  PURPOSE:  To hold the bits of '*this' set, the bit for identity integer
+    //	'id' being bit 'id % BITS_PER_WORD' of word 'id / BITS_PER_WORD'.
+    std::vector<unsigned long>
+    wordVect_;
+    
+    //  II.  Disallowed auto-generated methods:
+    
+    protected :
+    //  III.  Protected methods:
+    
+    public :
+    //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+    //  PURPOSE:  To initialize '*this' as an empty set that can hold the
+    //	Terminal instances with identity integers below 'numTerminals'.  No
+    //	return value.
+    TerminalSet		(uInt	numTerminals	= 0
+                     )
+    throw() :
+    wordVect_((numTerminals + BITS_PER_WORD - 1) / BITS_PER_WORD,0)
+    { }
+    
+    //  PURPOSE:  To release resources.  No parameters.  No return value.
+    ~TerminalSet		()
+    throw()
+    { }
+    
+    //  V.  Accessors:
+    //  PURPOSE:  To return 'true' if the Terminal with identity integer 'id'
+    //	is in '*this' set, or 'false' otherwise.
+    bool		has	(uInt	id
+                         )
+    const
+    throw()
+    { return( (wordVect_[id / BITS_PER_WORD] >> (id % BITS_PER_WORD)) & 1 ); }
+    
+    //  PURPOSE:  To return the smallest identity integer at least 'id' that is
+    //	in '*this' set, or -1 if there is none.
+    int		findNext(uInt	id
+                         )
+    const
+    throw()
+    {
+        for  (uInt wi = id / BITS_PER_WORD;  wi < wordVect_.size();  wi++)
+        {
+            unsigned long	word	= wordVect_[wi];
+            
+            if  (wi == id / BITS_PER_WORD)
+                word	&= ~0UL << (id % BITS_PER_WORD);
+            
+            if  (word != 0)
+                return(wi * BITS_PER_WORD + __builtin_ctzl(word));
+        }
+        
+        return(-1);
+    }
+    
+    //  VI.  Mutators:
+    //  PURPOSE:  To put the Terminal with identity integer 'id' in '*this' set.
+    //	No return value.
+    void		insert	(uInt	id
+                         )
+    throw()
+    { wordVect_[id / BITS_PER_WORD] |= 1UL << (id % BITS_PER_WORD); }
+    
+    //  PURPOSE:  To make '*this' set empty.  No parameters.  No return value.
+    void		clear	()
+    throw()
+    { std::fill(wordVect_.begin(),wordVect_.end(),0); }
+    
+    //  VII.  Methods that do main and misc work of class:
+    //  PURPOSE:  To put the members of 'other' (which must be able to hold the
+    //	same Terminal instances) in '*this' set too.  Returns 'true' if that
+    //	added any, or 'false' otherwise.
+    bool		unionWith
+    (const TerminalSet&	other
+     )
+    throw()
+    {
+        unsigned long	added	= 0;
+        
+        for  (uInt wi = 0;  wi < wordVect_.size();  wi++)
+        {
+            added		|= other.wordVect_[wi] & ~wordVect_[wi];
+            wordVect_[wi]	|= other.wordVect_[wi];
+        }
+        
+        return(added != 0);
+    }
+    
+};
+
 //  PURPOSE:  To implement a set of 'NonTerminal*' pointers to which items
 //	can be added, and that we would be guarannteed would be iterated
 //	over.  This differs from the set<> template in that the set<>
@@ -123,6 +271,11 @@ class		SafeSet
     std::vector<NonTerminal*>
     itemVect_;
     
+    //  PURPOSE:  To tell, for each NonTerminal identity integer, whether that
+    //	NonTerminal is in 'itemVect_', so 'insert()' need not search it.
+    std::vector<bool>
+    isPresentVect_;
+    
     //  II.  Disallowed auto-generated methods:
     //  No copy constructor:
     SafeSet		(const SafeSet&
@@ -166,21 +319,7 @@ class		SafeSet
     //  PURPOSE:  To insert 'item' in '*this' only if it is not already present.
     //	No return value.
     void		insert	(NonTerminal*	item
-                         )
-    {
-        //  I.  Application validity check:
-        
-        //  II.  Consider inserting 'item':
-        //	II.A.  See if 'item' is already present:
-        for  (int i = 0;  i < getSize();  i++)
-            if  (itemVect_[i] == item)
-                return;
-        
-        //  II.B.  If get here the 'item' is not present: insert it:
-        itemVect_.push_back(item);
-        
-        //  III.  Finished:
-    }
+                         );
     
 };
 
@@ -191,10 +330,6 @@ class		SafeSet
 class		Symbol
 {
     //  I.  Member vars:
-    //  PURPOSE:  To hold the global count of the next Symbol identity integer.
-    static
-    int			nextId_;
-    
     //  PURPOSE:  To hold the identity integer of '*this' Symbol.
     int			id_;
     
@@ -219,11 +354,13 @@ class		Symbol
     
     public :
     //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
-    //  PURPOSE:  To create a new symbol with name 'newName'.  No return value.
-    Symbol 		(const std::string&	newName
+    //  PURPOSE:  To create a new symbol with identity integer 'newId' and
+    //	name 'newName'.  No return value.
+    Symbol 		(int			newId,
+                 const std::string&	newName
                  )
     throw() :
-    id_(nextId_++),
+    id_(newId),
     name_(newName)
     { }
     
@@ -309,10 +446,6 @@ class		Symbol
 };
 
 
-//  PURPOSE:  To hold the global count of the next Symbol identity integer.
-int		Symbol::nextId_		= 0;
-
-
 //  PURPOSE:  To release resources.  No parameter.  No return value.
 //	NOTE: Does nothing.  Exists as a properly defined method to satisfy
 //	the linker.
@@ -342,11 +475,13 @@ class		Terminal : public Symbol
     
     public :
     //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
-    //  PURPOSE:  To create a new symbol with name 'newName'.  No return value.
-    Terminal 		(const std::string&	newName
+    //  PURPOSE:  To create a new symbol with identity integer 'newId' and
+    //	name 'newName'.  No return value.
+    Terminal 		(int			newId,
+                     const std::string&	newName
                      )
     throw() :
-    Symbol(newName)
+    Symbol(newId,newName)
     { }
     
     //  V.  Accessors:
@@ -399,11 +534,13 @@ class		NonTerminal : public Symbol
     
     public :
     //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
-    //  PURPOSE:  To create a new symbol with name 'newName'.  No return value.
-    NonTerminal 		(const std::string&	newName
+    //  PURPOSE:  To create a new symbol with identity integer 'newId' and
+    //	name 'newName'.  No return value.
+    NonTerminal 		(int			newId,
+                         const std::string&	newName
                          )
     throw() :
-    Symbol(newName),
+    Symbol(newId,newName),
     canDeriveEmpty_(false)
     { }
     
@@ -435,18 +572,52 @@ class		NonTerminal : public Symbol
 };
 
 
+//  PURPOSE:  To insert 'item' in '*this' only if it is not already present.
+//	No return value.
+void		SafeSet::insert	(NonTerminal*	item
+                         )
+{
+    //  I.  Application validity check:
+    
+    //  II.  Consider inserting 'item':
+    //	II.A.  See if 'item' is already present:
+    uInt	id	= item->getId();
+    
+    if  (id >= isPresentVect_.size())
+        isPresentVect_.resize(id + 1,false);
+    
+    if  (isPresentVect_[id])
+        return;
+    
+    //  II.B.  If get here the 'item' is not present: insert it:
+    isPresentVect_[id]	= true;
+    itemVect_.push_back(item);
+    
+    //  III.  Finished:
+}
+
+
 //  PURPOSE:  To keep track of the defined Terminal and NonTerminal symbols
-//	of a Grammar.
+//	of a Grammar.  Symbol instances are held in a vector indexed by their
+//	identity integers, which each SymbolTable gives out from 0.
 class		SymbolTable
 {
     //  I.  Member vars:
-    //  PURPOSE:  To map from the names of Terminals to pointers to them.
-    std::map<std::string,Terminal*>
-    nameToTerminalPtrMap_;
+    //  PURPOSE:  To hold pointers to the Symbol instances, indexed by their
+    //	identity integers.
+    std::vector<Symbol*>
+    symbolPtrVect_;
+    
+    //  PURPOSE:  To map from the names of Symbols to their identity integers.
+    std::unordered_map<std::string,int>
+    nameToIdMap_;
     
-    //  PURPOSE:  To map from the names of NonTerminals to pointers to them.
-    std::map<std::string,NonTerminal*>
-    nameToNonTerminalPtrMap_;
+    //  PURPOSE:  To hold the number of Terminal instances.
+    uInt			numTerminals_;
+    
+    //  PURPOSE:  To hold the number in the name of the next NonTerminal made
+    //	by 'newNonTerminal()' to try.
+    int			nextNonTermIndex_;
     
     //  II.  Disallowed auto-created methods:
     //  No copy constructor:
@@ -460,16 +631,36 @@ class		SymbolTable
     
     protected :
     //  III.  Protected methods:
+    //  PURPOSE:  To add the newly-created Symbol '*symPtr' to '*this' store.
+    //	No return value.
+    void		add	(Symbol*	symPtr
+                     )
+    throw()
+    {
+        symbolPtrVect_.push_back(symPtr);
+        nameToIdMap_[symPtr->getName()]	= symPtr->getId();
+    }
     
     public :
+    //  PURPOSE:  To tell how many built-in Terminal instances (end-of-input
+    //	and the int and float constants) every SymbolTable registers first,
+    //	so the identity integers of those a grammar defines start here.
+    static
+    const uInt		NUM_BUILT_IN_TERMINALS	= 3;
+    
     //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
     //  PURPOSE:  To initialize '*this' store.  No parameters.  No return value.
     SymbolTable		()
-    throw(const char*)
+    throw(const char*) :
+    numTerminals_(0),
+    nextNonTermIndex_(0)
     {
         registerTerminal(END_SYMBOL);
         registerTerminal(INTEGER_CONST_SYMBOL);
         registerTerminal(FLOAT_CONST_SYMBOL);
+        
+        if  (numTerminals_ != NUM_BUILT_IN_TERMINALS)
+            throw "NUM_BUILT_IN_TERMINALS does not match the built-in terminals";
     }
     
     //  PURPOSE;  To release resources.  No parameters.  No return value.
@@ -479,26 +670,10 @@ class		SymbolTable
         //  I.  Application validity check:
         
         //  II.  Release resources:
-        //  II.A.  Release NonTerminal instances:
-        for  (std::map<std::string,NonTerminal*>::iterator
-              iter  = nameToNonTerminalPtrMap_.begin();
-              iter != nameToNonTerminalPtrMap_.end();
-              iter++
-              )
-        {
-            delete(iter->second);
-            iter->second	= NULL;
-        }
-        
-        //  II.B.  Release Terminal instances:
-        for  (std::map<std::string,Terminal*>::iterator
-              iter  = nameToTerminalPtrMap_.begin();
-              iter != nameToTerminalPtrMap_.end();
-              iter++
-              )
+        for  (uInt i = 0;  i < symbolPtrVect_.size();  i++)
         {
-            delete(iter->second);
-            iter->second	= NULL;
+            delete(symbolPtrVect_[i]);
+            symbolPtrVect_[i]	= NULL;
         }
         
         //  III.  Finished:
@@ -511,7 +686,7 @@ class		SymbolTable
     ()
     const
     throw()
-    { return(nameToTerminalPtrMap_.size()); }
+    { return(numTerminals_); }
     
     //  PURPOSE:  To return the number of NonTerminal instances in '*this' store.
     //	No parameters.
@@ -519,7 +694,7 @@ class		SymbolTable
     ()
     const
     throw()
-    { return(nameToNonTerminalPtrMap_.size()); }
+    { return(symbolPtrVect_.size() - numTerminals_); }
     
     //  PURPOSE:  To return the number of symbols in '*this' store.  No
     //	parameters.
@@ -527,43 +702,22 @@ class		SymbolTable
     ()
     const
     throw()
-    { return(   nameToTerminalPtrMap_.size()  +
-             nameToNonTerminalPtrMap_.size()
-             );
-    }
+    { return(symbolPtrVect_.size()); }
     
     //  PURPOSE:  To return a pointer to the Symbol with identity integer
     //	'id', or 'NULL' if no such Symbol has been found.
     Symbol*	getSymbol
     (int	i
      )
+    const
     throw()
     {
         //  I.  Application validity check:
+        if  ( (i < 0)  ||  (i >= (int)symbolPtrVect_.size()) )
+            return(NULL);
         
         //  II.  Return value:
-        for  (std::map<std::string,Terminal*>::iterator
-              iter  = nameToTerminalPtrMap_.begin();
-              iter != nameToTerminalPtrMap_.end();
-              iter++
-              )
-        {
-            if  (iter->second->getId() == i)
-                return(iter->second);
-        }
-        
-        for  (std::map<std::string,NonTerminal*>::iterator
-              iter  = nameToNonTerminalPtrMap_.begin();
-              iter != nameToNonTerminalPtrMap_.end();
-              iter++
-              )
-        {
-            if  (iter->second->getId() == i)
-                return(iter->second);
-        }
-        
-        //  III.  Finished:
-        return(NULL);
+        return(symbolPtrVect_[i]);
     }
     
     //  VI.  Mutators:
@@ -580,11 +734,10 @@ class		SymbolTable
         //  I.  Application validity check:
         
         //  II.  Look for 'name':
-        std::map<std::string,Terminal*>::iterator
-        termIter	= nameToTerminalPtrMap_.find(name);
+        Symbol*	symPtr	= find(name);
         
-        if  (termIter != nameToTerminalPtrMap_.end())
-            return(termIter->second);
+        if  ( (symPtr != NULL)  &&  symPtr->getIsTerminal() )
+            return((Terminal*)symPtr);
         
         //  III.  Finished:
         return(NULL);
@@ -599,26 +752,19 @@ class		SymbolTable
         //  I.  Application validity check:
         
         //  II.  Look for 'name':
-        //  II.A.  Look among terminals:
-        std::map<std::string,Terminal*>::iterator
-        termIter	= nameToTerminalPtrMap_.find(name);
-        
-        if  (termIter != nameToTerminalPtrMap_.end())
-            return(termIter->second);
+        std::unordered_map<std::string,int>::iterator
+        iter	= nameToIdMap_.find(name);
         
-        //  II.B.  Look among non-terminals:
-        std::map<std::string,NonTerminal*>::iterator
-        nonTermIter	= nameToNonTerminalPtrMap_.find(name);
-        
-        if  (nonTermIter != nameToNonTerminalPtrMap_.end())
-            return(nonTermIter->second);
+        if  (iter != nameToIdMap_.end())
+            return(symbolPtrVect_[iter->second]);
         
         //  III.  Finished:
         return(NULL);
     }
     
     //  PURPOSE:  To register a new terminal named 'name'.  No return value.
-    //	Throws exception if 'name' already in use.
+    //	Throws exception if 'name' already in use, or if a NonTerminal has
+    //	already been registered (Terminal identity integers come first).
     void		registerTerminal
     (const std::string&	name
      )
@@ -633,8 +779,12 @@ class		SymbolTable
             throw text;
         }
         
+        if  (numTerminals_ != symbolPtrVect_.size())
+            throw "Terminal registered after a NonTerminal";
+        
         //  II.  Create and register Terminal:
-        nameToTerminalPtrMap_[name]  = new Terminal(name);
+        add(new Terminal(symbolPtrVect_.size(),name));
+        numTerminals_++;
         
         //  III.  Finished:
     }
@@ -656,7 +806,7 @@ class		SymbolTable
         }
         
         //  II.  Create and register Terminal:
-        nameToNonTerminalPtrMap_[name]	= new NonTerminal(name);
+        add(new NonTerminal(symbolPtrVect_.size(),name));
         
         //  III.  Finished:
     }
@@ -672,22 +822,21 @@ class		SymbolTable
         
         //  II.  Create new NonTerminal instance:
         //  II.A.  Each iteration tries another name to see if it is available:
-        static
-        int		nonTermIndex		= 0;
         char	nonTermName[TEXT_LEN];
         
         do
         {
-            snprintf(nonTermName,TEXT_LEN,"NT%d",nonTermIndex);
-            nonTermIndex++;
+            snprintf(nonTermName,TEXT_LEN,"NT%d",nextNonTermIndex_);
+            nextNonTermIndex_++;
         }
         while  (find(nonTermName) != NULL);
         
         //  II.B.  Create and register new 'NonTerminal' instance:
-        std::string		name(nonTermName);
-        NonTerminal*	nonTermPtr	= new NonTerminal(name);
+        NonTerminal*	nonTermPtr	= new NonTerminal(symbolPtrVect_.size(),
+                                                  nonTermName
+                                                  );
         
-        nameToNonTerminalPtrMap_[name]	= nonTermPtr;
+        add(nonTermPtr);
         
         //  III.  Finished:
         return(nonTermPtr);
@@ -700,11 +849,6 @@ class		SymbolTable
 class		Production
 {
     //  I.  Member vars:
-    //  PURPOSE:  To hold the global count of the next Production identity
-    //	integer.
-    static
-    int			nextId_;
-    
     //  PURPOSE:  To hold the identity integer of '*this' Production.
     int			id_;
     
@@ -741,14 +885,15 @@ class		Production
     
     public :
     //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
-    //  PURPOSE:  To initialize '*this' Production to have left-handside
-    //	NonTerminal 'newLhsPtr' and right-handside Symbol instances as given
-    //	in 'newRhs'.  No return value.
-    Production		(NonTerminal*			newLhsPtr,
+    //  PURPOSE:  To initialize '*this' Production to have identity integer
+    //	'newId', left-handside NonTerminal 'newLhsPtr' and right-handside
+    //	Symbol instances as given in 'newRhs'.  No return value.
+    Production		(int				newId,
+                     NonTerminal*			newLhsPtr,
                      const std::vector<Symbol*>&	newRhs
                      )
     throw() :
-    id_(nextId_++),
+    id_(newId),
     lhsPtr_(newLhsPtr),
     canDeriveEmpty_(false),
     nonEmptySymbolCount_(0)
@@ -833,10 +978,9 @@ class		Production
     
     
     //  VII.  Methods that do main and misc work of this class:
-    //  PURPOSE:  To create and return a std::set<> of Terminal instances that
-    //	may begin expansions of '*this' Production in Grammar 'grammar'.
-    std::set<Terminal*>
-    createPredictedTerminalSet
+    //  PURPOSE:  To create and return the set of Terminal instances that may
+    //	begin expansions of '*this' Production in Grammar 'grammar'.
+    TerminalSet	createPredictedTerminalSet
     (Grammar&	grammar)
     const
     throw();
@@ -968,11 +1112,6 @@ class		Production
     
 };
 
-//  PURPOSE:  To hold the global count of the next Production identity
-//	integer.
-int		Production::nextId_	= 0;
-
-
 //  PURPOSE:  To return 'true' if 'lhs' is less than 'rhs', or 'false'
 //	otherwise.
 bool		operator<	(const std::vector<Symbol*>&	lhs,
@@ -1063,6 +1202,19 @@ public:
          );
     }
     
+    //  PURPOSE:  To return the char 'offset' chars past the current one, or
+    //	'\0' if there is none.
+    char		peekAhead
+    (uInt	offset
+     )
+    const
+    throw()
+    { return
+        ( (index_ + offset >= input_.length())
+         ? '\0' : input_[index_ + offset]
+         );
+    }
+    
     //  PURPOSE:  To return 'true' if at eof-of-input, or 'false' otherwise.
     bool		isAtEnd	()
     const
@@ -1077,6 +1229,194 @@ public:
         if  (index_ < input_.length())  index_++;
     }
     
+    //  PURPOSE:  To advance 'count' chars (but not past the end).  No return
+    //	value.
+    void		advanceBy
+    (uInt	count
+     )
+    throw()
+    {
+        index_	= (index_ + count < input_.length()) ? index_ + count
+                                                        : input_.length();
+    }
+    
+};
+
+
+//  PURPOSE:  To recognize the Terminal instances of a Grammar directly in an
+//	InputCharStream, as a trie of their names in which each node has a row
+//	of next nodes indexed by character class.  Only the characters that
+//	occur in names get a class of their own; all others share class 0,
+//	which never leads anywhere.
+class		TerminalTrie
+{
+    //  I.  Member vars:
+    //  PURPOSE:  To hold the class of each character.
+    std::vector<uInt>	charClassVect_;
+    
+    //  PURPOSE:  To hold the number of character classes.
+    uInt			numClasses_;
+    
+    //  PURPOSE:  To hold, at '[node * numClasses_ + class]', the node reached
+    //	from 'node' on a character of 'class', or -1 if none is.  Node 0 is
+    //	the root.
+    std::vector<int>	nextNodeVect_;
+    
+    //  PURPOSE:  To hold, for each node, the Terminal whose name ends there,
+    //	or 'NULL' if none does.
+    std::vector<const Terminal*>
+    terminalPtrVect_;
+    
+    //  II.  Disallowed auto-generated methods:
+    //  No copy constructor:
+    TerminalTrie		(const TerminalTrie&
+                         );
+    
+    //  No copy assignment op:
+    TerminalTrie&	operator=
+    (const TerminalTrie&
+     );
+    
+    protected :
+    //  III.  Protected methods:
+    //  PURPOSE:  To add a node with no next nodes, and return its index.  No
+    //	parameters.
+    int		addNode	()
+    throw()
+    {
+        nextNodeVect_.resize(nextNodeVect_.size() + numClasses_,-1);
+        terminalPtrVect_.push_back(NULL);
+        return(terminalPtrVect_.size() - 1);
+    }
+    
+    public :
+    //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+    //  PURPOSE:  To initialize '*this' to recognize nothing.  No parameters.
+    //	No return value.
+    TerminalTrie		()
+    throw() :
+    charClassVect_(256,0),
+    numClasses_(1)
+    {
+        addNode();
+    }
+    
+    //  PURPOSE:  To release resources.  No parameters.  No return value.
+    ~TerminalTrie	()
+    throw()
+    { }
+    
+    //  V.  Accessors:
+    //  PURPOSE:  To return the number of nodes in '*this'.  No parameters.
+    uInt		getNumNodes
+    ()
+    const
+    throw()
+    { return(terminalPtrVect_.size()); }
+    
+    //  VI.  Mutators:
+    //  PURPOSE:  To make '*this' recognize the names of the Terminal instances
+    //	in 'symbolTable', other than the built-in ones (end-of-input and the
+    //	constants).  No return value.
+    void		build	(const SymbolTable&	symbolTable
+                         )
+    throw()
+    {
+        //  I.  Application validity check:
+        
+        //  II.  Build:
+        //  II.A.  Give each character that occurs in a name a class:
+        charClassVect_.assign(256,0);
+        numClasses_	= 1;
+        
+        for  (uInt ti = SymbolTable::NUM_BUILT_IN_TERMINALS;
+              ti < symbolTable.getNumTerminals();
+              ti++
+              )
+        {
+            const std::string&	name	= symbolTable.getSymbol(ti)->getName();
+            
+            for  (uInt i = 0;  i < name.length();  i++)
+                if  (charClassVect_[(unsigned char)name[i]] == 0)
+                    charClassVect_[(unsigned char)name[i]]	= numClasses_++;
+        }
+        
+        //  II.B.  Add the path of each name:
+        nextNodeVect_.clear();
+        terminalPtrVect_.clear();
+        addNode();
+        
+        for  (uInt ti = SymbolTable::NUM_BUILT_IN_TERMINALS;
+              ti < symbolTable.getNumTerminals();
+              ti++
+              )
+        {
+            const Symbol*	symPtr	= symbolTable.getSymbol(ti);
+            const std::string&	name	= symPtr->getName();
+            int			node	= 0;
+            
+            for  (uInt i = 0;  i < name.length();  i++)
+            {
+                uInt	index	= node * numClasses_ +
+                                  charClassVect_[(unsigned char)name[i]];
+                
+                if  (nextNodeVect_[index] < 0)
+                {
+                    int	newNode	= addNode();
+                    
+                    nextNodeVect_[index]	= newNode;
+                }
+                
+                node	= nextNodeVect_[index];
+            }
+            
+            terminalPtrVect_[node]	= (const Terminal*)symPtr;
+        }
+        
+        //  III.  Finished:
+    }
+    
+    //  VII.  Methods that do main and misc work of class:
+    //  PURPOSE:  To return a pointer to the Terminal with the longest name
+    //	that 'inputCharStream' begins with, and to set 'length' to the
+    //	length of that name, or to return 'NULL' if it begins with none.
+    const Terminal*
+    match	(const InputCharStream&	inputCharStream,
+             uInt&			length
+             )
+    const
+    throw()
+    {
+        //  I.  Application validity check:
+        
+        //  II.  Walk down the trie, noting the last node a name ends at:
+        const Terminal*	toReturn	= NULL;
+        int			node		= 0;
+        
+        for  (uInt i = 0;  ;  i++)
+        {
+            uInt	charClass	=
+            charClassVect_[(unsigned char)inputCharStream.peekAhead(i)];
+            
+            if  (charClass == 0)
+                break;
+            
+            node	= nextNodeVect_[node * numClasses_ + charClass];
+            
+            if  (node < 0)
+                break;
+            
+            if  (terminalPtrVect_[node] != NULL)
+            {
+                toReturn	= terminalPtrVect_[node];
+                length		= i + 1;
+            }
+        }
+        
+        //  III.  Finished:
+        return(toReturn);
+    }
+    
 };
 
 
@@ -1088,6 +1428,9 @@ class		TokenStream
     //	defined.
     SymbolTable&		symbolTable_;
     
+    //  PURPOSE:  To refer to the object that recognizes the defined Terminals.
+    const TerminalTrie&	terminalTrie_;
+    
     //  PURPOSE:  To hold the source of the character input.
     InputCharStream&	inputCharStream_;
     
@@ -1131,15 +1474,9 @@ class		TokenStream
         //  I.  Application validity check:
         
         //  II.  To read a number from 'inputCharStream_':
-        //  II.A.  Initialize object into which to put characters of number:
-        std::string	lex("");
-        
-        //  II.B.  Gather digits:
+        //  II.A.  Skip digits:
         while  ( isdigit(inputCharStream_.peek()) )
-        {
-            lex += inputCharStream_.peek();
             inputCharStream_.advance();
-        }
         
         //  II.C.  Distinguish between integers and floating point constants:
         const Terminal*	symbolPtr;
@@ -1154,14 +1491,10 @@ class		TokenStream
         {
             //  II.C.2.  If do have decimal point the have a floating point const.
             //  	   Continue reading optional digits after decimal point:
-            lex += inputCharStream_.peek();
             inputCharStream_.advance();
             
             while  ( isdigit(inputCharStream_.peek()) )
-            {
-                lex += inputCharStream_.peek();
                 inputCharStream_.advance();
-            }
             
             symbolPtr	= floatPtConstTerminalPtr_;
         }
@@ -1193,29 +1526,29 @@ class		TokenStream
         if  ( isdigit(inputCharStream_.peek()) )
             return( scanDigits() );
         
-        //  II.D.  Try to interpret as an ordinary Terminal:
-        //  II.D.1.  Gather chars into 'lexeme':
-        std::string	lexeme;
-        
-        lexeme += inputCharStream_.peek();
+        //  II.D.  Try to interpret as an ordinary Terminal: the one with the
+        //	   longest name that the input begins with:
+        uInt		length	= 0;
+        const Terminal*	symPtr	= terminalTrie_.match(inputCharStream_,length);
         
-        for  ( inputCharStream_.advance();
-              !inputCharStream_.isAtEnd() && !isspace(inputCharStream_.peek());
-              inputCharStream_.advance()
-              )
-            lexeme += inputCharStream_.peek();
+        //  II.E.  Complain if none, quoting the input up to whitespace:
+        if  (symPtr == NULL)
+        {
+            std::string	lexeme;
             
-            //	II.D.2.  Look up 'lexeme' in symbol table:
-            const Terminal*	symPtr	= symbolTable_.findTerminal(lexeme);
+            for  (uInt i = 0;
+                  (inputCharStream_.peekAhead(i) != '\0')  &&
+                  !isspace(inputCharStream_.peekAhead(i));
+                  i++
+                  )
+                lexeme += inputCharStream_.peekAhead(i);
             
-            //  II.D.3.  Complain if not found:
-            if  (symPtr == NULL)
-            {
-                snprintf(text,TEXT_LEN,"Undeclared symbol %s in input.",lexeme.c_str());
-                throw text;
-            }
+            snprintf(text,TEXT_LEN,"Undeclared symbol %s in input.",lexeme.c_str());
+            throw text;
+        }
         
         //  III.  Finished:
+        inputCharStream_.advanceBy(length);
         return(symPtr);
     }
     
@@ -1223,12 +1556,15 @@ class		TokenStream
     //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
     //  PURPOSE:  To initialize '*this' to read characters from
     //	'newInputCharStream' and turn them into Symbol instances as defined by
-    //	'newSymbolTable'.  No return value.
+    //	'newSymbolTable' and recognized by 'newTerminalTrie'.  No return
+    //	value.
     TokenStream		(SymbolTable&		newSymbolTable,
+                     const TerminalTrie&	newTerminalTrie,
                      InputCharStream&	newInputCharStream
                      )
     throw(const char*) :
     symbolTable_(newSymbolTable),
+    terminalTrie_(newTerminalTrie),
     inputCharStream_(newInputCharStream),
     lastParsedPtr_(NULL),
     endOfInputTerminalPtr_
@@ -1289,6 +1625,143 @@ class		TokenStream
 //									//
 //	----	----	----	----	----	----	----	----	//
 
+//  PURPOSE:  To map a file read-only into memory for as long as '*this'
+//	lives, so that it may be read in place rather than copied.
+class		MappedFile
+{
+    //  I.  Member vars:
+    //  PURPOSE:  To point to the first byte of the mapping, or to be 'NULL' if
+    //	the file is empty.
+    char*		bytePtr_;
+    
+    //  PURPOSE:  To hold the number of bytes mapped.
+    size_t		length_;
+    
+    //  II.  Disallowed auto-generated methods:
+    //  No default constructor:
+    MappedFile		();
+    
+    //  No copy constructor:
+    MappedFile		(const MappedFile&
+                     );
+    
+    //  No copy assignment op:
+    MappedFile&		operator=
+    (const MappedFile&
+     );
+    
+    protected :
+    //  III.  Protected methods:
+    
+    public :
+    //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+    //  PURPOSE:  To initialize '*this' to map the file at path 'pathPtr'.
+    //	No return value.
+    MappedFile		(const char*	pathPtr
+                     )
+    throw(const char*) :
+    bytePtr_(NULL),
+    length_(0)
+    {
+        //  I.  Application validity check:
+        int		fd	= open(pathPtr,O_RDONLY);
+        struct stat	status;
+        
+        if  ( (fd < 0)  ||  (fstat(fd,&status) != 0) )
+        {
+            if  (fd >= 0)
+                close(fd);
+            
+            snprintf(text,TEXT_LEN,"Cannot open %s",pathPtr);
+            throw text;
+        }
+        
+        //  II.  Map file:
+        length_	= (size_t)status.st_size;
+        
+        if  (length_ > 0)
+        {
+            void*	mapPtr	= mmap(NULL,length_,PROT_READ,MAP_PRIVATE,fd,0);
+            
+            if  (mapPtr == MAP_FAILED)
+            {
+                close(fd);
+                snprintf(text,TEXT_LEN,"Cannot map %s",pathPtr);
+                throw text;
+            }
+            
+            bytePtr_	= (char*)mapPtr;
+        }
+        
+        //  III.  Finished (the mapping outlives the descriptor):
+        close(fd);
+    }
+    
+    //  PURPOSE:  To release resources.  No parameters.  No return value.
+    ~MappedFile		()
+    throw()
+    {
+        if  (bytePtr_ != NULL)
+            munmap(bytePtr_,length_);
+    }
+    
+    //  V.  Accessors:
+    //  PURPOSE:  To return the address of the first byte of the file.  No
+    //	parameters.
+    const char*	getBytes
+    ()
+    const
+    throw()
+    { return(bytePtr_); }
+    
+    //  PURPOSE:  To return the number of bytes in the file.  No parameters.
+    size_t	getLength
+    ()
+    const
+    throw()
+    { return(length_); }
+    
+};
+
+
+//  PURPOSE:  To begin a file that holds a built Grammar.  After it come, in
+//	order: 'uint32_t' arrays of the offset of each Symbol's name in the
+//	names (plus the end), the LHS of each Production, the offset of each
+//	Production's RHS (plus the end), the RHS Symbols back-to-back, and the
+//	table row offsets; then the 'uint16_t' arrays of the table's Production
+//	indices and checks; then the names.  Identity integers stand for
+//	Symbol instances throughout.
+struct		GrammarFileHeader
+{
+    //  PURPOSE:  To hold 'GRAMMAR_FILE_MAGIC'.
+    char		magic_[4];
+    
+    //  PURPOSE:  To hold 'GRAMMAR_FILE_VERSION'.
+    uint32_t		version_;
+    
+    //  PURPOSE:  To hold the hash of the description the Grammar was built
+    //	from, so a file built from another description is rejected.
+    uint64_t		descriptionHash_;
+    
+    //  PURPOSE:  To hold the hash of the bytes after '*this', so a damaged
+    //	file is rejected.
+    uint64_t		payloadHash_;
+    
+    //  PURPOSE:  To hold the counts of the arrays that follow.
+    uint32_t		numTerminals_;
+    uint32_t		numSymbols_;
+    uint32_t		startSymbolId_;
+    uint32_t		numProductions_;
+    uint32_t		numRhsSymbols_;
+    uint32_t		tableSize_;
+    uint32_t		namesLength_;
+    
+    //  PURPOSE:  To keep the arrays that follow aligned.
+    uint32_t		padding_;
+    
+};
+
+
 //  PURPOSE:  To represent a Grammar.
 class		Grammar
 {
@@ -1303,8 +1776,45 @@ class		Grammar
     std::vector<Production*>
     productionPtrVect_;
     
-    //  PURPOSE:  To hold the 2-D table of (Symbol x Terminal) -> Production*.
-    Production***		llTableMetaHandle_;
+    //  PURPOSE:  To hold the identity integer of the next Production made by
+    //	'newProduction()'.
+    int			nextProductionId_;
+    
+    //  PURPOSE:  To hold, for each NonTerminal (by identity integer less the
+    //	number of Terminal instances), the offset of its row in
+    //	'llTableProdIndexVect_'.  The rows of the (NonTerminal x Terminal)
+    //	-> Production table are displaced so they interleave without sharing
+    //	a slot, as a comb.
+    std::vector<uInt>	llTableRowBaseVect_;
+    
+    //  PURPOSE:  To hold, for each slot of the packed table, the index in
+    //	'productionPtrVect_' of the Production to do.
+    std::vector<uint16_t>
+    llTableProdIndexVect_;
+    
+    //  PURPOSE:  To hold, for each slot of the packed table, the row that owns
+    //	it, or 'NO_TABLE_ROW' if none does.
+    std::vector<uint16_t>
+    llTableCheckVect_;
+    
+    //  PURPOSE:  To hold, for each Symbol by identity integer, the Terminal
+    //	instances that may begin the strings it derives.
+    std::vector<TerminalSet>
+    firstSetVect_;
+    
+    //  PURPOSE:  To hold, for each NonTerminal by identity integer, the Terminal
+    //	instances that may follow it in the strings the Grammar derives.
+    std::vector<TerminalSet>
+    followSetVect_;
+    
+    //  PURPOSE:  To be 'true' if the status of '*this' Grammar, its table and
+    //	the predicted sets should be printed as they are built, or 'false'
+    //	otherwise.
+    bool			shouldPrint_;
+    
+    //  PURPOSE:  To recognize the Terminal instances of '*this' Grammar in
+    //	text to parse.
+    TerminalTrie		terminalTrie_;
     
     //  II.  Disallowed auto-generated methods:
     //  No copy constructor:
@@ -1826,7 +2336,7 @@ class		Grammar
                     rhsVect.push_back(symPtr);
                 }
                 
-                productionPtrVect_.push_back(new Production(lhsPtr,rhsVect));
+                productionPtrVect_.push_back(newProduction(lhsPtr,rhsVect));
                 
                 if  (c == SET_SEPARATOR_CHAR)
                     index++;
@@ -2003,7 +2513,7 @@ class		Grammar
                 //Productions ← Productions ∪ { A → αV }
                 std::vector<Symbol*>	alphaV  =   prefix;
                 alphaV.push_back(v);
-                Production* prodAlphaV = new Production(nonTermPtr,    alphaV);
+                Production* prodAlphaV = newProduction(nonTermPtr,    alphaV);
                 addProduction(prodAlphaV);
                 
                 //foreach p ∈ ProductionsFor(A) | RHS(p) = αβp do
@@ -2025,7 +2535,7 @@ class		Grammar
                         }
                         betaP.erase(betaP.begin(),betaP.begin()+prefix.size());
                     
-                        Production* prodBetaP = new Production(v,    betaP);
+                        Production* prodBetaP = newProduction(v,    betaP);
                         addProduction(prodBetaP);
                     }
                     
@@ -2050,136 +2560,332 @@ class		Grammar
     
     
     //  PURPOSE:  To compute the derives empty member var for NonTerminal
-    //	instances and productions.
+    //	instances and productions.  Each NonTerminal shown to derive empty
+    //	is visited once, and only the places it occurs are updated, so the
+    //	time is linear in the total length of the productions.
     void		computeDerivesEmpty
     ()
     throw()
     {
         //  I.  Application validity check:
         
-        //  II.
-        for  (int pi = 0;  pi < getNumProductions();  pi++)
-            productionPtrVect_[pi]->initNonEmptySymbolCount();
+        //  II.  Compute derives empty:
+        //  II.A.  Index, for each NonTerminal by identity integer, the
+        //	     (Production, RHS position) pairs where it occurs:
+        std::vector< std::vector< std::pair<Production*,uInt> > >
+        occurrenceVectVect(getNumSymbols());
+        
+        for  (uInt pi = 0;  pi < getNumProductions();  pi++)
+        {
+            Production*	prodPtr	= productionPtrVect_[pi];
+            
+            prodPtr->initNonEmptySymbolCount();
             
-            SafeSet		toDoSet;
+            for  (uInt i = 0;  i < prodPtr->getRhsLength();  i++)
+                if  (prodPtr->getRhsSymbol(i)->getIsNonTerminal())
+                    occurrenceVectVect[prodPtr->getRhsSymbol(i)->getId()].
+                    push_back(std::make_pair(prodPtr,i));
+        }
+        
+        //  II.B.  Seed 'toDoSet' with the LHS of the empty Production instances:
+        SafeSet		toDoSet;
         
-        for  (int pi = 0;  pi < getNumProductions();  pi++)
+        for  (uInt pi = 0;  pi < getNumProductions();  pi++)
             productionPtrVect_[pi]->checkForEmpty(toDoSet);
+        
+        //  II.C.  Each iteration takes one NonTerminal that derives empty,
+        //	     and counts it off at each place it occurs:
+        for  (uInt si = 0;  si < toDoSet.getSize();  si++)
+        {
+            const std::vector< std::pair<Production*,uInt> >&
+            occurrenceVect	= occurrenceVectVect[toDoSet.get(si)->getId()];
+            
+            for  (uInt oi = 0;  oi < occurrenceVect.size();  oi++)
+            {
+                Production*	prodPtr	= occurrenceVect[oi].first;
+                
+                prodPtr->decNonEmptySymbolCount();
+                prodPtr->checkForEmpty(toDoSet);
+            }
+        }
+        
+        //  III.  Finished:
+    }
+    
+    //  PURPOSE:  To compute 'firstSetVect_' and 'followSetVect_' for all
+    //	Symbol instances at once, each as the least fixpoint of its equations:
+    //	passes are made over the productions, OR-ing sets into each other,
+    //	until a pass adds nothing.  Must be called after
+    //	'computeDerivesEmpty()'.  No parameters.  No return value.
+    void		computeFirstAndFollowSets
+    ()
+    throw()
+    {
+        //  I.  Application validity check:
+        
+        //  II.  Compute sets:
+        //  II.A.  Start with the FIRST set of each Terminal being itself, and
+        //	     all others empty:
+        uInt		numTerminals	= symbolTable_.getNumTerminals();
+        bool		didChange;
+        TerminalSet	tailSet(numTerminals);
+        
+        firstSetVect_.assign(getNumSymbols(),TerminalSet(numTerminals));
+        followSetVect_.assign(getNumSymbols(),TerminalSet(numTerminals));
+        
+        for  (uInt ti = 0;  ti < numTerminals;  ti++)
+            firstSetVect_[ti].insert(ti);
+        
+        //  II.B.  FIRST(A) holds FIRST(X) for each production A - ... X ...
+        //	     where all before X derive empty:
+        do
+        {
+            didChange	= false;
             
-            for  (int si = 0;  si < toDoSet.getSize();  si++)
+            for  (uInt pi = 0;  pi < getNumProductions();  pi++)
             {
-                NonTerminal*	nonTermPtr	= toDoSet.get(si);
-                int		i;
+                const Production*	prodPtr	= productionPtrVect_[pi];
+                TerminalSet&	lhsSet	=
+                firstSetVect_[prodPtr->getLhsPtr()->getId()];
                 
-                for  (int pi = 0;  pi < getNumProductions();  pi++)
+                for  (uInt ri = 0;  ri < prodPtr->getRhsLength();  ri++)
                 {
-                    Production*	prodPtr	= productionPtrVect_[pi];
+                    const Symbol*	symPtr	= prodPtr->getRhsSymbol(ri);
                     
-                    for  (i = 0;  i < prodPtr->getRhsLength();  i++)
-                        if  (nonTermPtr == prodPtr->getRhsSymbol(i))
-                            break;
+                    if  (lhsSet.unionWith(firstSetVect_[symPtr->getId()]))
+                        didChange	= true;
+                    
+                    if  ( !symPtr->canDeriveEmpty() )
+                        break;
+                }
+            }
+        }
+        while  (didChange);
+        
+        //  II.C.  FOLLOW(B) holds FIRST(tail) for each production A - ... B tail,
+        //	     and FOLLOW(A) too if all of tail derives empty.  Each RHS is
+        //	     walked from its end back, gathering FIRST(tail) in 'tailSet':
+        do
+        {
+            didChange	= false;
+            
+            for  (uInt pi = 0;  pi < getNumProductions();  pi++)
+            {
+                const Production*	prodPtr	= productionPtrVect_[pi];
+                int			lhsId	= prodPtr->getLhsPtr()->getId();
+                bool		doesTailDeriveEmpty	= true;
+                
+                tailSet.clear();
+                
+                for  (uInt ri = prodPtr->getRhsLength();  ri-- > 0; )
+                {
+                    const Symbol*	symPtr	= prodPtr->getRhsSymbol(ri);
+                    TerminalSet&	symSet	= followSetVect_[symPtr->getId()];
+                    
+                    if  ( symPtr->getIsNonTerminal() )
+                    {
+                        if  (symSet.unionWith(tailSet))
+                            didChange	= true;
+                        
+                        if  ( doesTailDeriveEmpty  &&
+                             symSet.unionWith(followSetVect_[lhsId])
+                             )
+                            didChange	= true;
+                    }
                     
-                    if  (i >= prodPtr->getRhsLength())
-                        continue;
+                    if  ( !symPtr->canDeriveEmpty() )
+                    {
+                        tailSet.clear();
+                        doesTailDeriveEmpty	= false;
+                    }
                     
-                    prodPtr->decNonEmptySymbolCount();
-                    prodPtr->checkForEmpty(toDoSet);
+                    tailSet.unionWith(firstSetVect_[symPtr->getId()]);
                 }
             }
+        }
+        while  (didChange);
+        
+        //  III.  Finished:
     }
     
-    //  PURPOSE:  To construct the table 'llTableMetaHandle_'.  No parameters.
-    //	No return value.
+    //  PURPOSE:  To put the row for the NonTerminal numbered 'row', whose
+    //	entries are the Terminal identity integers in 'termIdVect' and the
+    //	Production indices in 'prodIndexVect', in the packed table at the
+    //	first offset where none of its entries lands on a used slot.
+    //	'firstFreeSlot' is the lowest slot that might be unused, and is
+    //	advanced past the ones this row uses.  No return value.
+    void		packTableRow
+    (uInt				row,
+     const std::vector<int>&	termIdVect,
+     const std::vector<int>&	prodIndexVect,
+     uInt&				firstFreeSlot
+     )
+    throw()
+    {
+        //  I.  Application validity check:
+        if  (termIdVect.empty())
+        {
+            llTableRowBaseVect_[row]	= 0;
+            return;
+        }
+        
+        //  II.  Pack row:
+        //  II.A.  Find the first offset that fits, starting where the first
+        //	     entry would land on the first free slot:
+        uInt	base	= (firstFreeSlot > (uInt)termIdVect[0])
+                          ? firstFreeSlot - termIdVect[0]
+                          : 0;
+        uInt	i;
+        
+        for  ( ;  ;  base++)
+        {
+            for  (i = 0;  i < termIdVect.size();  i++)
+            {
+                uInt	slot	= base + termIdVect[i];
+                
+                if  ( (slot < llTableCheckVect_.size())  &&
+                      (llTableCheckVect_[slot] != NO_TABLE_ROW)
+                    )
+                    break;
+            }
+            
+            if  (i == termIdVect.size())
+                break;
+        }
+        
+        //  II.B.  Claim the slots:
+        uInt	limit	= base + termIdVect.back() + 1;
+        
+        if  (limit > llTableCheckVect_.size())
+        {
+            llTableCheckVect_.resize(limit,NO_TABLE_ROW);
+            llTableProdIndexVect_.resize(limit,0);
+        }
+        
+        for  (i = 0;  i < termIdVect.size();  i++)
+        {
+            llTableCheckVect_[base + termIdVect[i]]	= row;
+            llTableProdIndexVect_[base + termIdVect[i]]	= prodIndexVect[i];
+        }
+        
+        llTableRowBaseVect_[row]	= base;
+        
+        //  II.C.  Advance 'firstFreeSlot':
+        while  ( (firstFreeSlot < llTableCheckVect_.size())  &&
+                 (llTableCheckVect_[firstFreeSlot] != NO_TABLE_ROW)
+               )
+            firstFreeSlot++;
+        
+        //  III.  Finished:
+    }
+    
+    //  PURPOSE:  To construct the packed table in 'llTableRowBaseVect_',
+    //	'llTableProdIndexVect_' and 'llTableCheckVect_'.  Each NonTerminal's
+    //	row is first filled in densely (to find ambiguities) and then packed.
+    //	No parameters.  No return value.
     void		buildTable
     ()
     throw(const char*)
     {
         //  I.  Application validity check:
-        
-        //  II.  Construct 'llTableMetaHandle_':
-        //	II.A.  Allocate memory (calloc() automatically fills mem with NULLs):
         uInt	numTerminals	= symbolTable_.getNumTerminals();
-        
-        llTableMetaHandle_		= (Production***)
-        calloc
-        (symbolTable_.getNumSymbols(),
-         sizeof(Production**)
-         );
-        
-        for  (uInt si = 0;  si < symbolTable_.getNumSymbols();  si++)
-            llTableMetaHandle_[si]	= (Production**)
-            calloc
-            (numTerminals,
-             sizeof(Production*)
-             );
+        uInt	numRows		= symbolTable_.getNumNonTerminals();
+        
+        if  ( (numRows >= NO_TABLE_ROW)  ||
+              (getNumProductions() >= NO_TABLE_ROW)
+            )
+            throw "Grammar has too many symbols or productions for its table";
+        
+        //  II.  Construct table:
+        //	II.A.  Allocate memory:
+        std::vector<int>	rowVect(numTerminals,-1);
+        std::vector< std::vector<int> >
+        prodIndexVectVect(getNumSymbols());
+        std::vector<int>	termIdVect;
+        std::vector<int>	prodIndexVect;
+        uInt			firstFreeSlot	= 0;
+        
+        llTableRowBaseVect_.assign(numRows,0);
+        llTableProdIndexVect_.clear();
+        llTableCheckVect_.clear();
+        
+        for  (uInt pInd = 0;  pInd < getNumProductions();  pInd++)
+            prodIndexVectVect[productionPtrVect_[pInd]->getLhsPtr()->getId()].
+            push_back(pInd);
+        
+        //  II.B.  Build table:
+        //  II.B.1.  Each iteration iterates over a NonTerminal (they follow the
+        //	     Terminal instances):
+        for  (uInt si = numTerminals;  si < symbolTable_.getNumSymbols();  si++)
+        {
+            //  II.B.1.a.  Get the current symbol:
+            const Symbol*	symPtr	= symbolTable_.getSymbol(si);
             
-            //  II.B.  Build table:
-            //  II.B.1.  Each iteration iterates over a Symbol:
-            for  (uInt si = 0;  si < symbolTable_.getNumSymbols();  si++)
+            //  II.B.1.b.  Each iteration takes a production that expands the
+            //  	       NonTerminal '*symPtr':
+            for  (uInt i = 0;  i < prodIndexVectVect[si].size();  i++)
             {
-                //  II.B.1.a.  Get the current symbol:
-                const Symbol*	symPtr	= symbolTable_.getSymbol(si);
+                //  II.B.1.b.I.  Get current production:
+                int		pInd	= prodIndexVectVect[si][i];
+                Production*	prodPtr	= productionPtrVect_[pInd];
                 
-                //  II.B.1.b.  Ignore Symbol instances that are Terminal instances:
-                if  (symPtr->getIsTerminal())
-                    continue;
+                //  II.B.1.b.II.  Get the set of Terminal instances that an
+                //		  expansion of '*symPtr' via '*prodPtr' could begin
+                //		  with:
+                TerminalSet	set	= prodPtr->
+                createPredictedTerminalSet
+                (*this);
                 
-                //  II.B.1.c.  If get here then '*symPtr' is a NonTerminal:
-                //  II.B.1.c.I.  Each iteration sees if a production expands the
-                //  	       NonTerminal '*symPtr':
-                for  (uInt pInd = 0;  pInd < getNumProductions();  pInd++)
+                //  II.B.1.b.III.  Update row to note that when NonTerminal
+                //  		   '*symPtr' appears on the top of the stack, and
+                //		   any one of the Terminal instances in 'set'
+                //		   appear in the input stream, the production
+                //		   '*prodPtr' ought to be done:
+                for  (int termId = set.findNext(0);
+                      termId >= 0;
+                      termId = set.findNext(termId + 1)
+                      )
                 {
-                    //  II.B.1.c.I.A.  Get current production:
-                    Production*	prodPtr	= productionPtrVect_[pInd];
-                    
-                    //  II.B.1.c.I.B.  Ignore if does not expand 'symPtr':
-                    if  (prodPtr->getLhsPtr() != symPtr)
-                        continue;
-                    
-                    //  II.B.1.c.I.C.  '*prodPtr' does expand '*symPtr'.  Get the set of
-                    //  		   Terminal instances that an expansion of '*symPtr'
-                    //		   via '*prodPtr' could begin with:
-                    int			prLhsId	= prodPtr->getLhsPtr()->getId();
-                    std::set<Terminal*>	set	= prodPtr->
-                    createPredictedTerminalSet
-                    (*this);
-                    
-                    //  II.B.1.c.I.D.  Update table to note that when NonTerminal
-                    //  		   '*symPtr' appears on the top of the stack, and
-                    //		   any one of the Terminal instances in 'set'
-                    //		   appear in the input stream, the production
-                    //		   '*prodPtr' ought to be done:
-                    for  (std::set<Terminal*>::iterator
-                          iter	 = set.begin();
-                          iter	!= set.end();
-                          iter++
-                          )
+                    const Symbol*	termPtr	= symbolTable_.getSymbol(termId);
+                    
+                    //  II.B.1.b.III.1.  Complain if this table entry is already taken:
+                    if  ( rowVect[termId] >= 0 )
                     {
-                        const Terminal*	termPtr	= (*iter);
-                        int			termId	= termPtr->getId();
-                        
-                        //  II.B.1.c.I.D.1.  Complain if this table entry is already taken:
-                        if  ( llTableMetaHandle_[prLhsId][termId] != NULL )
-                        {
-                            snprintf(text,TEXT_LEN,
-                                     "Ambiguous action on %s/%s: both "
-                                     "productions \"%s\" and \"%s\" apply.",
-                                     prodPtr->getLhsPtr()->getName().c_str(),
-                                     termPtr->getName().c_str(),
-                                     llTableMetaHandle_[prLhsId][termId]->toString().c_str(),
-                                     prodPtr->toString().c_str()
-                                     );
-                            throw text;
-                        }
-                        
-                        //  II.B.1.c.I.D.2.  Update table:
-                        llTableMetaHandle_[prLhsId][termId]	= prodPtr;
-                        printTable();
+                        snprintf(text,TEXT_LEN,
+                                 "Ambiguous action on %s/%s: both "
+                                 "productions \"%s\" and \"%s\" apply.",
+                                 prodPtr->getLhsPtr()->getName().c_str(),
+                                 termPtr->getName().c_str(),
+                                 productionPtrVect_[rowVect[termId]]->toString().c_str(),
+                                 prodPtr->toString().c_str()
+                                 );
+                        throw text;
                     }
                     
+                    //  II.B.1.b.III.2.  Update row:
+                    rowVect[termId]	= pInd;
+                    
+                    if  (shouldPrint_)
+                        printTable(symPtr,rowVect);
                 }
                 
             }
+            
+            //  II.B.1.c.  Pack the row into the table, and clear 'rowVect'
+            //	       for the next:
+            termIdVect.clear();
+            prodIndexVect.clear();
+            
+            for  (uInt termId = 0;  termId < numTerminals;  termId++)
+                if  (rowVect[termId] >= 0)
+                {
+                    termIdVect.push_back(termId);
+                    prodIndexVect.push_back(rowVect[termId]);
+                    rowVect[termId]	= -1;
+                }
+            
+            packTableRow(si - numTerminals,termIdVect,prodIndexVect,firstFreeSlot);
+        }
         
         //  III.  Finished:
     }
@@ -2187,12 +2893,15 @@ class		Grammar
     public :
     //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
     //  PURPOSE:  To initialize '*this' Grammar from its description in
-    //		'descriptionStr'.  No return value.
-    Grammar		(const std::string&		descriptionStr
+    //		'descriptionStr'.  Prints its status and table as they are built
+    //		if 'newShouldPrint' is 'true'.  No return value.
+    Grammar		(const std::string&		descriptionStr,
+                 bool				newShouldPrint	= true
                  )
     throw(const char*) :
     startSymbolPtr_(NULL),
-    llTableMetaHandle_(NULL)
+    nextProductionId_(0),
+    shouldPrint_(newShouldPrint)
     {
         int	index	= 0;
         
@@ -2203,24 +2912,161 @@ class		Grammar
         factorCommonPrefixes();
         addEndTerms();
         computeDerivesEmpty();
-        printStatus();
+        computeFirstAndFollowSets();
+        
+        if  (shouldPrint_)
+            printStatus();
+        
         buildTable();
+        terminalTrie_.build(symbolTable_);
     }
     
-    //  PURPOSE:  To release resources.  No parameters.  No return value.
-    ~Grammar		()
-    throw()
+    //  PURPOSE:  To initialize '*this' Grammar from 'file', written by
+    //		'save()' for the description 'descriptionStr', without
+    //		recomputing anything.  Throws exception if 'file' is not such a
+    //		file of the current version, was built from another
+    //		description, or is damaged.  No return value.
+    Grammar		(const MappedFile&		file,
+                 const std::string&		descriptionStr
+                 )
+    throw(const char*) :
+    startSymbolPtr_(NULL),
+    nextProductionId_(0),
+    shouldPrint_(false)
     {
         //  I.  Application validity check:
+        //  I.A.  Check header:
+        const char*		bytePtr	= file.getBytes();
+        GrammarFileHeader	header;
+        
+        if  (file.getLength() < sizeof(header))
+            throw "Grammar file is too short";
+        
+        memcpy(&header,bytePtr,sizeof(header));
+        
+        if  (memcmp(header.magic_,GRAMMAR_FILE_MAGIC,sizeof(header.magic_)) != 0)
+            throw "Not a grammar file";
+        
+        if  (header.version_ != GRAMMAR_FILE_VERSION)
+            throw "Grammar file is of another version";
+        
+        if  (header.descriptionHash_ !=
+             computeHash(descriptionStr.data(),descriptionStr.length())
+             )
+            throw "Grammar file is stale: built from another description";
+        
+        //  I.B.  Check size and checksum of payload:
+        uInt	numTerminals	= header.numTerminals_;
+        uInt	numSymbols	= header.numSymbols_;
+        uInt	numProductions	= header.numProductions_;
+        size_t	payloadLength	=
+        sizeof(uint32_t) * ( (size_t)numSymbols + 1 + numProductions +
+                            numProductions + 1 + header.numRhsSymbols_ +
+                            (numSymbols - numTerminals)
+                            )				+
+        sizeof(uint16_t) * 2 * (size_t)header.tableSize_	+
+        header.namesLength_;
+        
+        if  ( (numTerminals < 3)  ||  (numTerminals >= numSymbols)  ||
+              (file.getLength() != sizeof(header) + payloadLength)
+            )
+            throw "Grammar file is damaged";
+        
+        if  (header.payloadHash_ !=
+             computeHash(bytePtr + sizeof(header),payloadLength)
+             )
+            throw "Grammar file is damaged: bad checksum";
+        
+        //  I.C.  Find arrays:
+        const uint32_t*	nameBeginPtr	= (const uint32_t*)(bytePtr + sizeof(header));
+        const uint32_t*	prodLhsPtr	= nameBeginPtr + numSymbols + 1;
+        const uint32_t*	prodRhsBeginPtr	= prodLhsPtr + numProductions;
+        const uint32_t*	prodRhsPtr	= prodRhsBeginPtr + numProductions + 1;
+        const uint32_t*	rowBasePtr	= prodRhsPtr + header.numRhsSymbols_;
+        const uint16_t*	tableProdPtr	= (const uint16_t*)
+                                          (rowBasePtr + numSymbols - numTerminals);
+        const uint16_t*	tableCheckPtr	= tableProdPtr + header.tableSize_;
+        const char*	namePtr		= (const char*)
+                                          (tableCheckPtr + header.tableSize_);
+        
+        //  II.  Initialize:
+        //  II.A.  Register Symbol instances (the first three are built in):
+        for  (uInt si = 0;  si < numSymbols;  si++)
+        {
+            if  ( (nameBeginPtr[si] > nameBeginPtr[si+1])  ||
+                  (nameBeginPtr[si+1] > header.namesLength_)
+                )
+                throw "Grammar file is damaged";
+            
+            std::string	name(namePtr + nameBeginPtr[si],
+                             nameBeginPtr[si+1] - nameBeginPtr[si]
+                             );
+            
+            if  (si < symbolTable_.getNumSymbols())
+            {
+                if  (name != symbolTable_.getSymbol(si)->getName())
+                    throw "Grammar file is damaged";
+            }
+            else
+            if  (si < numTerminals)
+                symbolTable_.registerTerminal(name);
+            else
+                symbolTable_.registerNonTerminal(name);
+        }
         
-        //  II.  Release resources:
-        for  (uInt i = 0;  i < symbolTable_.getNumSymbols();  i++)
-            free(llTableMetaHandle_[i]);
+        if  ( (header.startSymbolId_ < numTerminals)  ||
+              (header.startSymbolId_ >= numSymbols)
+            )
+            throw "Grammar file is damaged";
+        
+        startSymbolPtr_	= (const NonTerminal*)
+                          symbolTable_.getSymbol(header.startSymbolId_);
+        
+        //  II.B.  Create Production instances:
+        for  (uInt pi = 0;  pi < numProductions;  pi++)
+        {
+            std::vector<Symbol*>	rhsVect;
             
-            free(llTableMetaHandle_);
+            if  ( (prodLhsPtr[pi] < numTerminals)		||
+                  (prodLhsPtr[pi] >= numSymbols)		||
+                  (prodRhsBeginPtr[pi] > prodRhsBeginPtr[pi+1])	||
+                  (prodRhsBeginPtr[pi+1] > header.numRhsSymbols_)
+                )
+                throw "Grammar file is damaged";
             
-            //  III.  Finished:
+            for  (uInt i = prodRhsBeginPtr[pi];  i < prodRhsBeginPtr[pi+1];  i++)
+            {
+                if  (prodRhsPtr[i] >= numSymbols)
+                    throw "Grammar file is damaged";
+                
+                rhsVect.push_back(symbolTable_.getSymbol(prodRhsPtr[i]));
             }
+            
+            productionPtrVect_.push_back
+            (newProduction
+             ((NonTerminal*)symbolTable_.getSymbol(prodLhsPtr[pi]),rhsVect)
+             );
+        }
+        
+        //  II.C.  Copy table:
+        for  (uInt slot = 0;  slot < header.tableSize_;  slot++)
+            if  (tableProdPtr[slot] >= numProductions)
+                throw "Grammar file is damaged";
+        
+        llTableRowBaseVect_.assign(rowBasePtr,rowBasePtr + numSymbols - numTerminals);
+        llTableProdIndexVect_.assign(tableProdPtr,tableProdPtr + header.tableSize_);
+        llTableCheckVect_.assign(tableCheckPtr,tableCheckPtr + header.tableSize_);
+        
+        //  II.D.  Build recognizer:
+        terminalTrie_.build(symbolTable_);
+        
+        //  III.  Finished:
+    }
+    
+    //  PURPOSE:  To release resources.  No parameters.  No return value.
+    ~Grammar		()
+    throw()
+    { }
     
     //  V.  Accessors:
     //  PURPOSE:  To return a pointer to the starting symbol.  No parameters.
@@ -2231,6 +3077,14 @@ class		Grammar
     throw()
     { return(startSymbolPtr_); }
     
+    //  PURPOSE:  To return 'true' if '*this' Grammar prints what it builds, or
+    //	'false' otherwise.  No parameters.
+    bool		getShouldPrint
+    ()
+    const
+    throw()
+    { return(shouldPrint_); }
+    
     //  PURPOSE:  To return the number of Symbols in '*this' Grammar.  No
     //	parameters.
     uInt		getNumSymbols
@@ -2239,6 +3093,14 @@ class		Grammar
     throw()
     { return(symbolTable_.getNumSymbols()); }
     
+    //  PURPOSE:  To return the number of Terminal instances in '*this'
+    //	Grammar.  No parameters.
+    uInt		getNumTerminals
+    ()
+    const
+    throw()
+    { return(symbolTable_.getNumTerminals()); }
+    
     //  PURPOSE:  To return a pointer to the 'i'-th of Symbol in '*this' Grammar.
     //	No parameters.
     Symbol*	getSymbolPtr
@@ -2247,6 +3109,59 @@ class		Grammar
     throw()
     { return(symbolTable_.getSymbol(i)); }
     
+    //  PURPOSE:  To return the set of Terminal instances that may begin the
+    //	strings that '*symPtr' derives.
+    const TerminalSet&
+    getFirstSet	(const Symbol*	symPtr
+                 )
+    const
+    throw()
+    { return(firstSetVect_[symPtr->getId()]); }
+    
+    //  PURPOSE:  To return the set of Terminal instances that may follow
+    //	'*nonTermPtr' in the strings '*this' Grammar derives.
+    const TerminalSet&
+    getFollowSet(const NonTerminal*	nonTermPtr
+                 )
+    const
+    throw()
+    { return(followSetVect_[nonTermPtr->getId()]); }
+    
+    //  PURPOSE:  To return a pointer to the Production to do when NonTerminal
+    //	with identity integer 'nonTermId' is on top of the stack and the
+    //	Terminal with identity integer 'termId' is next in the input, or
+    //	'NULL' if there is none.
+    Production*	getTableProduction
+    (int	nonTermId,
+     int	termId
+     )
+    const
+    throw()
+    {
+        uInt	row	= nonTermId - symbolTable_.getNumTerminals();
+        uInt	slot	= llTableRowBaseVect_[row] + termId;
+        
+        if  ( (slot < llTableCheckVect_.size())  &&
+              (llTableCheckVect_[slot] == row)
+            )
+            return(productionPtrVect_[llTableProdIndexVect_[slot]]);
+        
+        return(NULL);
+    }
+    
+    //  PURPOSE:  To return the number of bytes the LL(1) table takes.  No
+    //	parameters.
+    size_t	getTableNumBytes
+    ()
+    const
+    throw()
+    {
+        return(llTableRowBaseVect_.size() * sizeof(uInt)		+
+               llTableProdIndexVect_.size() * sizeof(uint16_t)	+
+               llTableCheckVect_.size() * sizeof(uint16_t)
+               );
+    }
+    
     //  PURPOSE:  To return the number of Production instances in '*this'
     //	Grammar.  No parameters.
     uInt		getNumProductions
@@ -2276,13 +3191,29 @@ class		Grammar
         return(symbolTable_.newNonTerminal());
     }
     
-    
-    //  PURPOSE:  To add the production pointed to by 'prodPtr' to '*this'
-    //	Grammar.  No return value.
-    void		addProduction
-    (Production*	prodPtr
+    //  PURPOSE:  To return a pointer to a newly-created Production with
+    //	left-handside NonTerminal 'lhsPtr' and right-handside Symbol
+    //	instances as given in 'rhs', numbered after those already made for
+    //	'*this' Grammar.  It is not added to '*this' Grammar.
+    Production*	newProduction
+    (NonTerminal*			lhsPtr,
+     const std::vector<Symbol*>&	rhs
      )
-    throw(const char*)
+    throw()
+    {
+        //  I.  Application validity check:
+        
+        //  II.  Create and return pointer to new Production instance.
+        return(new Production(nextProductionId_++,lhsPtr,rhs));
+    }
+    
+    
+    //  PURPOSE:  To add the production pointed to by 'prodPtr' to '*this'
+    //	Grammar.  No return value.
+    void		addProduction
+    (Production*	prodPtr
+     )
+    throw(const char*)
     {
         //  I.  Application validity check:
         if  (prodPtr == NULL)
@@ -2356,10 +3287,15 @@ class		Grammar
         //  III.  Finished:
         }
         
-        //  PURPOSE:  To print the Symbol x Terminal -> Production table.  No
-        //	parameters.  No return value.
+        //  PURPOSE:  To print the Symbol x Terminal -> Production table.  If
+        //	'pendingSymPtr' is not 'NULL' then its row is taken from
+        //	'pendingRowVect', which gives the index of the Production for each
+        //	Terminal (or -1), as it has yet to be packed into the table.  No
+        //	return value.
         void		printTable
-        ()
+        (const Symbol*			pendingSymPtr	= NULL,
+         const std::vector<int>&	pendingRowVect	= std::vector<int>()
+         )
         throw()
         {
             //  I.  Application validity check:
@@ -2377,13 +3313,28 @@ class		Grammar
             //	II.B.1.  Each iteration prints one row:
             for  (uInt i0 = 0;  i0 < symbolTable_.getNumSymbols();  i0++)
             {
-                std::cout << symbolTable_.getSymbol(i0)->getName() << '\t';
+                const Symbol*	symPtr	= symbolTable_.getSymbol(i0);
+                
+                std::cout << symPtr->getName() << '\t';
                 
                 for  (uInt i1 = 0;  i1 < symbolTable_.getNumTerminals();  i1++)
-                    if  (llTableMetaHandle_[i0][i1] == NULL)
+                {
+                    const Production*	prodPtr	= NULL;
+                    
+                    if  (symPtr == pendingSymPtr)
+                    {
+                        if  (pendingRowVect[i1] >= 0)
+                            prodPtr	= productionPtrVect_[pendingRowVect[i1]];
+                    }
+                    else
+                    if  ( symPtr->getIsNonTerminal() )
+                        prodPtr	= getTableProduction(i0,i1);
+                    
+                    if  (prodPtr == NULL)
                         std::cout << "--\t";
                     else
-                        std::cout << 'p' << llTableMetaHandle_[i0][i1]->getId() << '\t';
+                        std::cout << 'p' << prodPtr->getId() << '\t';
+                }
                 
                 std::cout << std::endl;
             }
@@ -2395,400 +3346,1350 @@ class		Grammar
         }
         
         
+        //  PURPOSE:  To write '*this' Grammar, built from 'descriptionStr', to
+        //	the file at 'pathPtr' in the format of 'GrammarFileHeader', so
+        //	it may be loaded without recomputation.  No return value.
+        void		save	(const char*		pathPtr,
+                             const std::string&	descriptionStr
+                             )
+        const
+        throw(const char*)
+        {
+            //  I.  Application validity check:
+            
+            //  II.  Write file:
+            //  II.A.  Compose payload:
+            uInt			numSymbols	= getNumSymbols();
+            std::vector<uint32_t>	nameBeginVect;
+            std::vector<uint32_t>	prodLhsVect;
+            std::vector<uint32_t>	prodRhsBeginVect;
+            std::vector<uint32_t>	prodRhsVect;
+            std::string		names;
+            
+            for  (uInt si = 0;  si < numSymbols;  si++)
+            {
+                nameBeginVect.push_back(names.length());
+                names	+= symbolTable_.getSymbol(si)->getName();
+            }
+            
+            nameBeginVect.push_back(names.length());
+            
+            for  (uInt pi = 0;  pi < getNumProductions();  pi++)
+            {
+                const Production*	prodPtr	= productionPtrVect_[pi];
+                
+                prodLhsVect.push_back(prodPtr->getLhsPtr()->getId());
+                prodRhsBeginVect.push_back(prodRhsVect.size());
+                
+                for  (uInt i = 0;  i < prodPtr->getRhsLength();  i++)
+                    prodRhsVect.push_back(prodPtr->getRhsSymbol(i)->getId());
+            }
+            
+            prodRhsBeginVect.push_back(prodRhsVect.size());
+            
+            std::string	payload;
+            
+            payload.append((const char*)nameBeginVect.data(),
+                           nameBeginVect.size() * sizeof(uint32_t));
+            payload.append((const char*)prodLhsVect.data(),
+                           prodLhsVect.size() * sizeof(uint32_t));
+            payload.append((const char*)prodRhsBeginVect.data(),
+                           prodRhsBeginVect.size() * sizeof(uint32_t));
+            payload.append((const char*)prodRhsVect.data(),
+                           prodRhsVect.size() * sizeof(uint32_t));
+            payload.append((const char*)llTableRowBaseVect_.data(),
+                           llTableRowBaseVect_.size() * sizeof(uint32_t));
+            payload.append((const char*)llTableProdIndexVect_.data(),
+                           llTableProdIndexVect_.size() * sizeof(uint16_t));
+            payload.append((const char*)llTableCheckVect_.data(),
+                           llTableCheckVect_.size() * sizeof(uint16_t));
+            payload	+= names;
+            
+            //  II.B.  Compose header:
+            GrammarFileHeader	header;
+            
+            memset(&header,0,sizeof(header));
+            memcpy(header.magic_,GRAMMAR_FILE_MAGIC,sizeof(header.magic_));
+            header.version_		= GRAMMAR_FILE_VERSION;
+            header.descriptionHash_	= computeHash(descriptionStr.data(),
+                                                      descriptionStr.length()
+                                                      );
+            header.payloadHash_		= computeHash(payload.data(),payload.length());
+            header.numTerminals_	= getNumTerminals();
+            header.numSymbols_		= numSymbols;
+            header.startSymbolId_	= getStartSymbolPtr()->getId();
+            header.numProductions_	= getNumProductions();
+            header.numRhsSymbols_	= prodRhsVect.size();
+            header.tableSize_		= llTableCheckVect_.size();
+            header.namesLength_		= names.length();
+            
+            //  II.C.  Write both:
+            FILE*	filePtr	= fopen(pathPtr,"wb");
+            
+            if  (filePtr == NULL)
+            {
+                snprintf(text,TEXT_LEN,"Cannot write %s",pathPtr);
+                throw text;
+            }
+            
+            bool	didWrite	=
+            (fwrite(&header,sizeof(header),1,filePtr) == 1)	&&
+            (fwrite(payload.data(),1,payload.length(),filePtr) == payload.length());
+            
+            if  ( (fclose(filePtr) != 0)  ||  !didWrite )
+            {
+                snprintf(text,TEXT_LEN,"Cannot write %s",pathPtr);
+                throw text;
+            }
+            
+            //  III.  Finished:
+        }
+        
+        
+        //  PURPOSE:  To return the name of the C++ enumerator for '*symPtr' in
+        //	a generated header: its own name after "T_" or "N_" if that is a
+        //	C++ identifier, or a name made from its identity integer if not.
+        std::string	getEnumName
+        (const Symbol*	symPtr
+         )
+        const
+        throw()
+        {
+            //  I.  Application validity check:
+            const std::string&	name	= symPtr->getName();
+            
+            if  (name == END_SYMBOL)
+                return("T_END");
+            
+            if  (name == INTEGER_CONST_SYMBOL)
+                return("T_INT_CONST");
+            
+            if  (name == FLOAT_CONST_SYMBOL)
+                return("T_FLOAT_CONST");
+            
+            //  II.  Compose name:
+            std::string	toReturn	= symPtr->getIsTerminal() ? "T_" : "N_";
+            
+            for  (uInt i = 0;  i < name.length();  i++)
+                if  ( !isalnum(name[i])  &&  (name[i] != '_') )
+                {
+                    snprintf(text,TEXT_LEN,"SYM%d",symPtr->getId());
+                    return(toReturn + text);
+                }
+            
+            //  III.  Finished:
+            return(toReturn + name);
+        }
+        
+        
+        //  PURPOSE:  To write to 'out' a self-contained C++ header, for
+        //	namespace 'name', that holds '*this' Grammar (described by
+        //	'descriptionStr') as 'constexpr' symbol enumerators, productions
+        //	and packed LL(1) table, with a tokenizer and a table-driven parse
+        //	function that use them.  Symbols are written as 'uint16_t', so
+        //	throws exception if there are more than fit.  No return value.
+        void		writeHeader
+        (std::ostream&		out,
+         const std::string&	name,
+         const std::string&	descriptionStr
+         )
+        const
+        throw(const char*)
+        {
+            //  I.  Application validity check:
+            uInt		numTerminals	= symbolTable_.getNumTerminals();
+            uInt		numSymbols	= symbolTable_.getNumSymbols();
+            uInt		tableSize	= llTableCheckVect_.size();
+            std::string	guard;
+            
+            if  (numSymbols > 0xFFFF)
+                throw "Grammar has too many symbols for a header";
+            
+            for  (uInt i = 0;  i < name.length();  i++)
+                guard	+= isalnum(name[i]) ? (char)toupper(name[i]) : '_';
+            
+            guard	+= "_H";
+            
+            //  II.  Write header:
+            //  II.A.  Write heading:
+            out << "//  " << name << ".h: LL(1) parser generated by llParserMaker"
+            << " for the grammar:\n//  " << descriptionStr << "\n\n"
+            << "#ifndef\t" << guard << "\n"
+            << "#define\t" << guard << "\n\n"
+            << "#include\t<cstdint>\n"
+            << "#include\t<cstring>\n"
+            << "#include\t<cctype>\n"
+            << "#include\t<string>\n"
+            << "#include\t<vector>\n\n"
+            << "namespace " << name << "\n{\n\n";
+            
+            //  II.B.  Write symbols:
+            out << "//  PURPOSE:  To number the symbols: Terminal instances first, then"
+            << "\n//\tNonTerminal instances.\n"
+            << "enum\tsymbol_t : uint16_t\n{\n";
+            
+            for  (uInt si = 0;  si < numSymbols;  si++)
+                out << "  " << getEnumName(symbolTable_.getSymbol(si))
+                << ((si + 1 < numSymbols) ? ",\n" : "\n");
+            
+            out << "};\n\n"
+            << "constexpr uint16_t\tNUM_TERMINALS\t= " << numTerminals << ";\n"
+            << "constexpr uint16_t\tNUM_BUILT_IN_TERMINALS\t= "
+            << (uInt)SymbolTable::NUM_BUILT_IN_TERMINALS << ";\n"
+            << "constexpr uint16_t\tNUM_SYMBOLS\t= " << numSymbols << ";\n"
+            << "constexpr uint16_t\tSTART_SYMBOL\t= "
+            << getEnumName(getStartSymbolPtr()) << ";\n"
+            << "constexpr uint16_t\tNO_PRODUCTION\t= 0xFFFF;\n\n"
+            << "//  PURPOSE:  To hold the names of the symbols, by 'symbol_t'.\n"
+            << "constexpr const char*\tSYMBOL_NAMES[]\t=\n{\n";
+            
+            for  (uInt si = 0;  si < numSymbols;  si++)
+            {
+                const std::string&	symName	= symbolTable_.getSymbol(si)->getName();
+                
+                out << "  \"";
+                
+                for  (uInt i = 0;  i < symName.length();  i++)
+                {
+                    if  ( (symName[i] == '"')  ||  (symName[i] == '\\') )
+                        out << '\\';
+                    
+                    out << symName[i];
+                }
+                
+                out << "\"" << ((si + 1 < numSymbols) ? ",\n" : "\n");
+            }
+            
+            out << "};\n\n";
+            
+            //  II.C.  Write productions, with right-hand sides stored
+            //	     back-to-back:
+            uInt	rhsIndex	= 0;
+            
+            out << "//  PURPOSE:  To hold the productions:\n";
+            
+            for  (uInt pi = 0;  pi < getNumProductions();  pi++)
+            {
+                std::string	prodStr	= getProductionPtr(pi)->toString();
+                
+                prodStr.erase(prodStr.find_last_not_of(' ') + 1);
+                out << "//\t" << pi << ":\t" << prodStr << "\n";
+            }
+            
+            out << "constexpr uint16_t\tPROD_LHS[]\t=\n{\n ";
+            
+            for  (uInt pi = 0;  pi < getNumProductions();  pi++)
+                out << " " << getEnumName(getProductionPtr(pi)->getLhsPtr()) << ",";
+            
+            out << "\n};\n\n"
+            << "//  PURPOSE:  To hold where each production's right-hand side"
+            << " begins in\n//\t'PROD_RHS', and where the last one ends.\n"
+            << "constexpr uint32_t\tPROD_RHS_BEGIN[]\t=\n{\n ";
+            
+            for  (uInt pi = 0;  pi < getNumProductions();  pi++)
+            {
+                out << " " << rhsIndex << ",";
+                rhsIndex	+= getProductionPtr(pi)->getRhsLength();
+            }
+            
+            out << " " << rhsIndex << "\n};\n\n"
+            << "constexpr uint16_t\tPROD_RHS[]\t=\n{\n ";
+            
+            for  (uInt pi = 0;  pi < getNumProductions();  pi++)
+                for  (uInt i = 0;  i < getProductionPtr(pi)->getRhsLength();  i++)
+                    out << " " << getEnumName(getProductionPtr(pi)->getRhsSymbol(i))
+                    << ",";
+            
+            out << " 0\n};\n\n";
+            
+            //  II.D.  Write packed table:
+            out << "//  PURPOSE:  To hold the LL(1) table.  The row of NonTerminal 'n'"
+            << " begins at\n//\tTABLE_ROW_BASE[n - NUM_TERMINALS] in"
+            << " TABLE_PROD, and slots whose\n//\tTABLE_CHECK is not that row"
+            << " are empty.\n"
+            << "constexpr uint32_t\tTABLE_ROW_BASE[]\t=\n{\n ";
+            
+            for  (uInt ri = 0;  ri < llTableRowBaseVect_.size();  ri++)
+                out << " " << llTableRowBaseVect_[ri] << ",";
+            
+            out << "\n};\n\n"
+            << "constexpr uint32_t\tTABLE_SIZE\t= " << tableSize << ";\n\n"
+            << "constexpr uint16_t\tTABLE_PROD[]\t=\n{\n ";
+            
+            for  (uInt slot = 0;  slot < tableSize;  slot++)
+                out << " " << llTableProdIndexVect_[slot] << ",";
+            
+            out << " 0\n};\n\n"
+            << "constexpr uint16_t\tTABLE_CHECK[]\t=\n{\n ";
+            
+            for  (uInt slot = 0;  slot < tableSize;  slot++)
+                out << " " << llTableCheckVect_[slot] << ",";
+            
+            out << " " << NO_TABLE_ROW << "\n};\n\n";
+            
+            //  II.E.  Write functions:
+            out <<
+            "//  PURPOSE:  To return the index of the production to do when"
+            " NonTerminal\n"
+            "//\t'nonTerm' is on top of the stack and Terminal 'term' is next,"
+            " or\n"
+            "//\t'NO_PRODUCTION' if there is none.\n"
+            "constexpr uint16_t\tlookup\t(uint16_t\tnonTerm,\n"
+            "\t\t\t\t uint16_t\tterm\n"
+            "\t\t\t\t)\n"
+            "{\n"
+            "  return( (TABLE_ROW_BASE[nonTerm - NUM_TERMINALS] + term < TABLE_SIZE)  &&\n"
+            "\t  (TABLE_CHECK[TABLE_ROW_BASE[nonTerm - NUM_TERMINALS] + term] ==\n"
+            "\t   nonTerm - NUM_TERMINALS\n"
+            "\t  )\n"
+            "\t  ? TABLE_PROD[TABLE_ROW_BASE[nonTerm - NUM_TERMINALS] + term]\n"
+            "\t  : NO_PRODUCTION\n"
+            "\t);\n"
+            "}\n\n\n"
+            "//  PURPOSE:  To append to 'tokens' the Terminal instances in"
+            " 'text', each\n"
+            "//\tthe one with the longest name the text goes on with (whitespace"
+            " between\n"
+            "//\tthem is optional), with numbers read as T_INT_CONST or"
+            " T_FLOAT_CONST,\n"
+            "//\tand ended by T_END.  Returns 'true' on success, or 'false' if"
+            " 'text'\n"
+            "//\thas an undeclared symbol.\n"
+            "inline\n"
+            "bool\t\ttokenize\t(const std::string&\t\ttext,\n"
+            "\t\t\t\t std::vector<uint16_t>&\ttokens\n"
+            "\t\t\t\t)\n"
+            "{\n"
+            "  size_t\tindex\t= 0;\n\n"
+            "  while  (true)\n"
+            "  {\n"
+            "    while  ( (index < text.length())  &&  isspace(text[index]) )\n"
+            "      index++;\n\n"
+            "    if  (index >= text.length())\n"
+            "      break;\n\n"
+            "    if  ( isdigit(text[index]) )\n"
+            "    {\n"
+            "      while  ( (index < text.length())  &&  isdigit(text[index]) )\n"
+            "\tindex++;\n\n"
+            "      if  ( (index < text.length())  &&  (text[index] == '.') )\n"
+            "      {\n"
+            "\tfor  (index++;  (index < text.length())  &&  isdigit(text[index]);"
+            "  index++);\n\n"
+            "\ttokens.push_back(T_FLOAT_CONST);\n"
+            "      }\n"
+            "      else\n"
+            "\ttokens.push_back(T_INT_CONST);\n\n"
+            "      continue;\n"
+            "    }\n\n"
+            "    uint16_t\tbestTerm\t= T_END;\n"
+            "    size_t\tbestLength\t= 0;\n\n"
+            "    for  (uint16_t term = NUM_BUILT_IN_TERMINALS;  term < NUM_TERMINALS;"
+            "  term++)\n"
+            "    {\n"
+            "      size_t\tlength\t= strlen(SYMBOL_NAMES[term]);\n\n"
+            "      if  ( (length > bestLength)  &&\n"
+            "\t    (strncmp(SYMBOL_NAMES[term],text.c_str() + index,length) == 0)\n"
+            "\t  )\n"
+            "      {\n"
+            "\tbestTerm\t= term;\n"
+            "\tbestLength\t= length;\n"
+            "      }\n"
+            "    }\n\n"
+            "    if  (bestLength == 0)\n"
+            "      return(false);\n\n"
+            "    index\t+= bestLength;\n"
+            "    tokens.push_back(bestTerm);\n"
+            "  }\n\n"
+            "  tokens.push_back(T_END);\n"
+            "  return(true);\n"
+            "}\n\n\n"
+            "//  PURPOSE:  To parse 'tokens', which should end with T_END.  Appends"
+            " the\n"
+            "//\tindex of each production done to '*derivationPtr' if it is not"
+            " NULL.\n"
+            "//\tReturns -1 if 'tokens' is a sentence, or else the index of the"
+            " token at\n"
+            "//\twhich a syntax error was found.\n"
+            "inline\n"
+            "long\t\tparse\t(const std::vector<uint16_t>&\ttokens,\n"
+            "\t\t\t std::vector<uint16_t>*\t\tderivationPtr\t= NULL\n"
+            "\t\t\t)\n"
+            "{\n"
+            "  std::vector<uint16_t>\tstack;\n"
+            "  size_t\t\tindex\t= 0;\n\n"
+            "  stack.reserve(256);\n"
+            "  stack.push_back(START_SYMBOL);\n\n"
+            "  while  ( !stack.empty() )\n"
+            "  {\n"
+            "    uint16_t\ttop\t= stack.back();\n"
+            "    uint16_t\ttoken\t= (index < tokens.size()) ? tokens[index]"
+            " : (uint16_t)T_END;\n\n"
+            "    stack.pop_back();\n\n"
+            "    if  (top < NUM_TERMINALS)\n"
+            "    {\n"
+            "      if  (top != token)\n"
+            "\treturn(index);\n\n"
+            "      if  (top == T_END)\n"
+            "\treturn(-1);\n\n"
+            "      index++;\n"
+            "    }\n"
+            "    else\n"
+            "    {\n"
+            "      uint16_t\tprod\t= lookup(top,token);\n\n"
+            "      if  (prod == NO_PRODUCTION)\n"
+            "\treturn(index);\n\n"
+            "      if  (derivationPtr != NULL)\n"
+            "\tderivationPtr->push_back(prod);\n\n"
+            "      for  (uint32_t i = PROD_RHS_BEGIN[prod+1];"
+            "  i > PROD_RHS_BEGIN[prod];  i--)\n"
+            "\tstack.push_back(PROD_RHS[i-1]);\n"
+            "    }\n"
+            "  }\n\n"
+            "  return(index);\n"
+            "}\n\n"
+            "}\n\n"
+            "#endif\n";
+            
+            //  III.  Finished:
+        }
+        
+        
+        //  PURPOSE:  To return the number of tokens in 'toScanStr', counting the
+        //	end-of-input.  Does not parse.
+        uInt		countTokens
+        (const std::string&	toScanStr
+         )
+        throw(const char*)
+        {
+            InputCharStream	inputStream(toScanStr);
+            TokenStream		tokenStream(symbolTable_,terminalTrie_,inputStream);
+            const Terminal*	endSymPtr	= symbolTable_.findTerminal(END_SYMBOL);
+            uInt		numTokens	= 1;
+            
+            while  (tokenStream.advance() != endSymPtr)
+                numTokens++;
+            
+            return(numTokens);
+        }
+        
+        
+        //  PURPOSE:  To print one step of a traced parse: the contents of
+        //	'stack' (top last, in parentheses) and the next input Terminal
+        //	'*inputPtr'.  No return value.
+        void		traceStack
+        (const std::vector<const Symbol*>&	stack,
+         const Terminal*			inputPtr
+         )
+        throw()
+        {
+            std::cout << "Stack:";
+            
+            for  (uInt i = 0;  i + 1 < stack.size();  i++)
+                std::cout << " " << stack[i]->getName();
+            
+            std::cout << " (" << stack.back()->getName() << ")"
+            << " / Input: " << inputPtr->getName()
+            << "\n";
+        }
+        
+        
+        //  PURPOSE:  To print 'message' indented by one tab per Symbol below the
+        //	top of a parse stack of depth 'depth', as one step of a traced
+        //	parse.  No return value.
+        void		traceAction
+        (uInt			depth,
+         const std::string&	message
+         )
+        throw()
+        {
+            for  (uInt i = 1;  i < depth;  i++)
+                std::cout << '\t';
+            
+            std::cout << message << std::endl;
+        }
+        
+        
         //  PURPOSE:  To attempt to parse the text in 'toParseStr' according to
-        //	'*this' Grammar.  No return value.
-        void		parse	(const std::string&	toParseStr
+        //	'*this' Grammar.  Prints each step to 'std::cout' if 'shouldTrace'
+        //	is 'true'; otherwise does no I/O.  The stack grows as needed.
+        //	No return value.
+        void		parse	(const std::string&	toParseStr,
+                             bool			shouldTrace	= false
                              )
         throw(const char*)
         {
             //  I.  Application validity check:
             
             //  II.  Attempt to parse:
-            const int		MAX_STACK_SIZE	= 100;
+            const uInt		INITIAL_STACK_SIZE	= 256;
             
             InputCharStream	inputStream(toParseStr);
-            TokenStream		tokenStream(symbolTable_,inputStream);
-            const Symbol*	stack[MAX_STACK_SIZE];
-            int			stackInd	= -1;
-            bool		accepted	= false;
+            TokenStream		tokenStream(symbolTable_,terminalTrie_,inputStream);
+            const int		numTerminals	= symbolTable_.getNumTerminals();
+            const Symbol*	endSymPtr	= symbolTable_.find(END_SYMBOL);
+            std::vector<const Symbol*>
+            stack;
             
-            stack[++stackInd]	= getStartSymbolPtr();
+            stack.reserve(INITIAL_STACK_SIZE);
+            stack.push_back(getStartSymbolPtr());
             
-            while  (!accepted)
+            while  (true)
             {
-                std::cout << "Stack:";
-                
-                for  (int i = 0;  i < stackInd;  i++)
-                    std::cout << " " << stack[i]->getName();
+                const Symbol*	topPtr	= stack.back();
+                const Terminal*	inputPtr= tokenStream.peek();
                 
-                std::cout << " (" << stack[stackInd]->getName() << ")"
-                << " / Input: " << tokenStream.peek()->getName()
-                << "\n";
+                if  (shouldTrace)
+                    traceStack(stack,inputPtr);
                 
-                if  (stack[stackInd]->getIsTerminal())
+                if  (topPtr->getId() < numTerminals)
                 {
-                    if  (stack[stackInd] != tokenStream.peek())
+                    if  (topPtr != inputPtr)
                     {
                         snprintf(text,TEXT_LEN,
                                  "Syntax error: Expected %s, found %s",
-                                 stack[stackInd]->getName().c_str(),
-                                 tokenStream.peek()->getName().c_str()
+                                 topPtr->getName().c_str(),
+                                 inputPtr->getName().c_str()
                                  );
                         throw text;
                     }
                     
-                    for  (int i = 0;  i < stackInd;  i++)
-                        std::cout << '\t';
-                    
-                    std::cout << "Matched\n";
+                    if  (shouldTrace)
+                        traceAction(stack.size(),"Matched");
                     
                     tokenStream.advance();
+                    stack.pop_back();
                     
-                    if  (stack[stackInd] == symbolTable_.find(END_SYMBOL))
-                        accepted = true;
-                    
-                    stackInd--;
+                    if  (topPtr == endSymPtr)
+                        break;
                 }
                 else
                 {
-                    Production**	handle	= llTableMetaHandle_[stack[stackInd]->getId()];
-                    Production*	prodPtr	= handle[tokenStream.peek()->getId()];
+                    Production*	prodPtr	= getTableProduction
+                    (topPtr->getId(),
+                     inputPtr->getId()
+                     );
                     
                     if  (prodPtr == NULL)
                     {
                         snprintf(text,TEXT_LEN,
                                  "Syntax error: no productions applicable"
                                  " expected symbol %s/found symbol %s",
-                                 stack[stackInd]->getName().c_str(),
-                                 tokenStream.peek()->getName().c_str()
+                                 topPtr->getName().c_str(),
+                                 inputPtr->getName().c_str()
                                  );
                         throw text;
                     }
                     
-                    for  (int i = 0;  i < stackInd;  i++)
-                        std::cout << '\t';
-                    
-                    std::cout << "Popping " << stack[stackInd]->getName() << std::endl;
-                    
-                    for  (int i = 0;  i < stackInd;  i++)
-                        std::cout << '\t';
-                    
-                    std::cout << "Invoking " << prodPtr->toString() << std::endl;
-                    
-                    stackInd--;
-                    
-                    for  (int i = prodPtr->getRhsLength()-1;  i >= 0;  i--)
+                    if  (shouldTrace)
                     {
-                        if  (stackInd >= MAX_STACK_SIZE)
-                            throw "Text is too complex to parse";
-                        
-                        stack[++stackInd]	= prodPtr->getRhsSymbol(i);
+                        traceAction(stack.size(),"Popping " + topPtr->getName());
+                        traceAction(stack.size(),"Invoking " + prodPtr->toString());
                     }
                     
+                    stack.pop_back();
+                    
+                    for  (int i = prodPtr->getRhsLength()-1;  i >= 0;  i--)
+                        stack.push_back(prodPtr->getRhsSymbol(i));
                 }
                 
             }
             
             //  III.  Finished:
-            std::cout << "Parse completed." << std::endl;
+            if  (shouldTrace)
+                std::cout << "Parse completed." << std::endl;
         }
         
         };
         
         
-        //  PURPOSE:  To print out the members of set 'termSet'.  No return value.
-        void	      	printSet(std::set<Terminal*>&	termSet
+        //  PURPOSE:  To print out the members of set 'termSet', which holds
+        //	Terminal instances of 'grammar'.  No return value.
+        void	      	printSet(const TerminalSet&	termSet,
+                                 Grammar&		grammar
                                  )
         throw()
         {
             //  I.  Application validity check:
             
             //  II.  Print members:
-            for  (std::set<Terminal*>::iterator
-                  iter  = termSet.begin();
-                  iter != termSet.end();
-                  iter++
+            for  (int termId = termSet.findNext(0);
+                  termId >= 0;
+                  termId = termSet.findNext(termId + 1)
                   )
-                std::cout << (*iter)->toString() << std::endl;
+                std::cout << grammar.getSymbolPtr(termId)->toString() << std::endl;
             
             //  III.  Finished:
         }
         
         
-        //  PURPOSE:  To copy the items in 'second' into 'first'.  No return value.
-        void		unionSecondIntoFirst
-        (std::set<Terminal*>&		first,
-         const std::set<Terminal*>&	second
+        //  PURPOSE:  To create and return the set of Terminal instances that may
+        //	begin expansions of '*this' Production in Grammar 'grammar'.
+        TerminalSet
+        Production::createPredictedTerminalSet
+        (Grammar&	grammar
          )
+        const
         throw()
         {
             //  I.  Application validity check:
             
-            //  II.  Copy items from 'second' into 'first':
-            for  (std::set<Terminal*>::iterator
-                  iter  = second.begin();
-                  iter != second.end();
-                  iter++
-                  )
-                first.insert(*iter);
+            //  II.  Compute set of Terminal instances:
+            //  II.A.  Obtain the Terminal instances that can be at the beginning of
+            //	     'rhs_': those of each symbol up to the first that cannot
+            //	     derive the empty string:
+            TerminalSet	toReturn(grammar.getNumTerminals());
+            
+            for  (uInt i = 0;  i < getRhsLength();  i++)
+            {
+                toReturn.unionWith(grammar.getFirstSet(getRhsSymbol(i)));
+                
+                if  ( !getRhsSymbol(i)->canDeriveEmpty() )
+                    break;
+            }
+            
+            //  II.B.  If 'rhs_' can derive the empty string, then also include the
+            //  	     Terminal instances that can follow the LHS in other productions:
+            if  ( canDeriveEmpty() )
+                toReturn.unionWith(grammar.getFollowSet(getLhsPtr()));
             
             //  III.  Finished:
+            if  (grammar.getShouldPrint())
+            {
+                std::cout << "The predicted term set of " << toString()
+                << " is:" << std::endl;
+                printSet(toReturn,grammar);
+            }
+            
+            return(toReturn);
+        }
+        
+        
+        //  PURPOSE:  To return the number of seconds since some fixed time.  No
+        //	parameters.
+        double		nowInSeconds
+        ()
+        throw()
+        {
+            struct timeval	now;
+            
+            gettimeofday(&now,NULL);
+            return(now.tv_sec + now.tv_usec / 1e6);
         }
         
         
-        //  PURPOSE:  To recursively create and return a set of pointers to all Symbol
-        //	instances that can appear at the beginning of any string to which the
-        //	Symbol instances of 'symbolList' may derive according to 'grammar'.
-        //	'haveVisitedMap' keeps track of the Terminal instances that have
-        //	already been considered.
-        std::set<Terminal*>
-        internalFirst
-        (const std::vector<Symbol*>&	symbolList,
-         Grammar&			grammar,
-         std::map<Symbol*,bool>&	haveVisitedMap
+        //  PURPOSE:  To return the description of an LL(1) Grammar with about
+        //	'numSymbols' symbols, one sixteenth of them Terminal instances.
+        //	Each NonTerminal 'N<i>' either begins with a Terminal and continues
+        //	with 'N<i+1>', or else is just the next Terminal (even 'i') or
+        //	empty (odd 'i').
+        std::string	generateGrammar
+        (uInt	numSymbols
          )
         throw()
         {
             //  I.  Application validity check:
+            uInt	numTerminals	= numSymbols / 16;
+            
+            if  (numTerminals < 2)
+                numTerminals	= 2;
+            
+            uInt	numNonTerminals	= (numSymbols > numTerminals + 4)
+                                      ? numSymbols - numTerminals - 3
+                                      : 1;
             
-            //  II.  Create and return set:
-            std::set<Terminal*>	toReturn;
+            //  II.  Compose description:
+            std::string	toReturn;
             
-            //  II.A.  Case 1: Handle when 'symbolList' is empty:
-            if  (symbolList.size() == 0)
-                return(toReturn);
+            toReturn	+= SET_BEGIN_CHAR;
             
-            //  II.B.  Case 2: Handle when 'symbolList' begins with a Terminal:
-            Symbol*	firstSymbolPtr	= symbolList[0];
+            for  (uInt ti = 0;  ti < numTerminals;  ti++)
+            {
+                snprintf(text,TEXT_LEN,"%st%u",(ti == 0) ? "" : ",",ti);
+                toReturn	+= text;
+            }
             
-            if  ( firstSymbolPtr->getIsTerminal() )
+            toReturn	+= "},{";
+            
+            for  (uInt ni = 0;  ni < numNonTerminals;  ni++)
             {
-                toReturn.insert((Terminal*)firstSymbolPtr);
-                return(toReturn);
+                snprintf(text,TEXT_LEN,"%sN%u",(ni == 0) ? "" : ",",ni);
+                toReturn	+= text;
             }
             
-            //  II.C.  Case 3: Handle when 'symbolList' begins with a NonTerminal:
-            if  ( !haveVisitedMap[firstSymbolPtr] )
+            toReturn	+= "},N0,{";
+            
+            for  (uInt ni = 0;  ni < numNonTerminals;  ni++)
             {
-                //  II.C.1.  Note that now have considered NonTerminal '*firstSymbolPtr':
-                haveVisitedMap[firstSymbolPtr]	= true;
+                if  (ni + 1 < numNonTerminals)
+                    snprintf(text,TEXT_LEN,"%sN%u - t%u N%u, ",
+                             (ni == 0) ? "" : ",",ni,ni % numTerminals,ni+1
+                             );
+                else
+                    snprintf(text,TEXT_LEN,"%sN%u - t%u, ",
+                             (ni == 0) ? "" : ",",ni,ni % numTerminals
+                             );
                 
-                //  II.C.2.  Find productions that derive '*firstSymbolPtr' to see
-                //		 to what they derive:
-                //	II.C.2.a.  Each iteration considers one production:
-                for  (uInt pi = 0;  pi < grammar.getNumProductions();  pi++)
-                {
-                    //  II.C.2.a.I.  Get the Production:
-                    const Production*	prodPtr = grammar.getProductionPtr(pi);
-                    
-                    //  II.C.2.a.II.  If it does derive '*firstSymbolPtr' then union its
-                    //  		first Terminal instances (determined by its RHS) into
-                    //		'toReturn':
-                    if  (prodPtr->getLhsPtr() == firstSymbolPtr)
-                        unionSecondIntoFirst
-                        (toReturn,
-                         internalFirst(prodPtr->getRhs(),grammar,haveVisitedMap)
-                         );
-                }
+                toReturn	+= text;
                 
-                //  II.C.2.b.  If '*firstSymbolPtr' can derive the empty string then
-                //		   add into 'toReturn' those Terminal instances that
-                //		   can follow 'firstSymbolPtr' in 'symbolList':
-                if  (firstSymbolPtr->canDeriveEmpty())
-                {
-                    //  II.C.2.b.I.  Build a string of Symbols that is 'symbolList', but
-                    //  	       with 'firstSymbolPtr' removed:
-                    std::vector<Symbol*>	subsequentList;
-                    
-                    for  (uInt si = 1;  si < symbolList.size();  si++)
-                        subsequentList.push_back(symbolList[si]);
-                    
-                    //  II.C.2.b.II.  Add into 'toReturn' those Terminal instance that
-                    //  		may start its derivations into Terminal instances:
-                    unionSecondIntoFirst
-                    (toReturn,
-                     internalFirst(subsequentList,grammar,haveVisitedMap)
-                     );
-                }
+                if  (ni % 2 == 0)
+                    snprintf(text,TEXT_LEN,"N%u - t%u",
+                             ni,(ni + 1) % numTerminals
+                             );
+                else
+                    snprintf(text,TEXT_LEN,"N%u - ",ni);
                 
+                toReturn	+= text;
             }
             
+            toReturn	+= SET_END_CHAR;
+            
             //  III.  Finished:
             return(toReturn);
         }
         
         
-        //  PURPOSE:  To create and return a set of pointers to all Symbol instances
-        //	that can appear at the beginning of any string to which the Symbol
-        //	instances of 'symbolList' may derive according to 'grammar'.
-        std::set<Terminal*>
-        first	(const std::vector<Symbol*>&	symbolList,
-                 Grammar&			grammar
-                 )
-        throw()
+        //  PURPOSE:  To report on 'std::cerr' how long it takes to register,
+        //	look up by identity integer and look up by name 'numSymbols'
+        //	symbols, and to build a Grammar of that many symbols.  Returns
+        //	'EXIT_SUCCESS' on success or 'EXIT_FAILURE' otherwise.
+        int		benchmarkSymbols
+        (uInt	numSymbols
+         )
+        {
+            const int	NUM_LOOKUP_PASSES	= 20;
+            
+            try
+            {
+                //  I.  Time the SymbolTable by itself:
+                std::vector<std::string>	nameVect;
+                double				startTime	= nowInSeconds();
+                double				registerTime;
+                double				getSymbolTime;
+                double				findTime;
+                double				findTerminalTime;
+                size_t				checkSum	= 0;
+                
+                {
+                    SymbolTable	symbolTable;
+                    
+                    for  (uInt si = symbolTable.getNumSymbols();  si < numSymbols;  si++)
+                    {
+                        snprintf(text,TEXT_LEN,"%c%u",(si % 16 == 0) ? 't' : 'N',si);
+                        nameVect.push_back(text);
+                    }
+                    
+                    startTime	= nowInSeconds();
+                    
+                    for  (uInt si = 0;  si < nameVect.size();  si++)
+                        if  (nameVect[si][0] == 't')
+                            symbolTable.registerTerminal(nameVect[si]);
+                    
+                    for  (uInt si = 0;  si < nameVect.size();  si++)
+                        if  (nameVect[si][0] == 'N')
+                            symbolTable.registerNonTerminal(nameVect[si]);
+                    
+                    registerTime	= nowInSeconds() - startTime;
+                    
+                    startTime	= nowInSeconds();
+                    
+                    for  (int pass = 0;  pass < NUM_LOOKUP_PASSES;  pass++)
+                        for  (uInt si = 0;  si < symbolTable.getNumSymbols();  si++)
+                            checkSum	+= symbolTable.getSymbol(si)->getName().length();
+                    
+                    getSymbolTime	= nowInSeconds() - startTime;
+                    
+                    startTime	= nowInSeconds();
+                    
+                    for  (int pass = 0;  pass < NUM_LOOKUP_PASSES;  pass++)
+                        for  (uInt si = 0;  si < nameVect.size();  si++)
+                            checkSum	+= symbolTable.find(nameVect[si])->getId();
+                    
+                    findTime	= nowInSeconds() - startTime;
+                    
+                    startTime	= nowInSeconds();
+                    
+                    for  (int pass = 0;  pass < NUM_LOOKUP_PASSES;  pass++)
+                        for  (uInt si = 0;  si < nameVect.size();  si++)
+                            checkSum	+= (symbolTable.findTerminal(nameVect[si]) != NULL);
+                    
+                    findTerminalTime	= nowInSeconds() - startTime;
+                }
+                
+                double	numLookups	= (double)NUM_LOOKUP_PASSES * nameVect.size();
+                
+                std::cerr << nameVect.size() << " symbols: register "
+                << registerTime * 1e3 << " ms, getSymbol "
+                << getSymbolTime * 1e9 / numLookups << " ns, find "
+                << findTime * 1e9 / numLookups << " ns, findTerminal "
+                << findTerminalTime * 1e9 / numLookups << " ns (checksum "
+                << checkSum << ")\n";
+                
+                //  II.  Time building a Grammar:
+                std::string	descriptionStr	= generateGrammar(numSymbols);
+                
+                startTime	= nowInSeconds();
+                
+                Grammar	grammar(descriptionStr,false);
+                
+                std::cerr << "Grammar of " << grammar.getNumSymbols()
+                << " symbols and " << grammar.getNumProductions()
+                << " productions built in "
+                << (nowInSeconds() - startTime) * 1e3 << " ms\n";
+            }
+            catch  (const char*	errCPtr)
+            {
+                std::cerr << errCPtr << std::endl;
+                return(EXIT_FAILURE);
+            }
+            
+            return(EXIT_SUCCESS);
+        }
+        
+        
+        //  PURPOSE:  To accept and count the chars written to it, and then to
+        //	discard them, so that writing a trace costs all but the I/O.
+        class		NullStreamBuf : public std::streambuf
+        {
+            //  I.  Member vars:
+            //  PURPOSE:  To hold the number of chars written.
+            size_t		numChars_;
+            
+            protected :
+            //  III.  Protected methods:
+            //  PURPOSE:  To count char 'c' as written.  Returns a value other
+            //	than 'traits_type::eof()' to tell that it was.
+            int_type	overflow(int_type	c
+                                 )
+            {
+                numChars_++;
+                return(traits_type::not_eof(c));
+            }
+            
+            //  PURPOSE:  To count the 'num' chars at 'charPtr' as written.
+            //	Returns 'num'.
+            std::streamsize	xsputn	(const char*		charPtr,
+                                         std::streamsize	num
+                                         )
+            {
+                numChars_	+= num;
+                return(num);
+            }
+            
+            public :
+            //  IV.  Constructor(s), assignment op(s), factory(s) and destructor:
+            //  PURPOSE:  To initialize '*this' to have had no chars written.
+            //	No parameters.  No return value.
+            NullStreamBuf	()
+            throw() :
+            numChars_(0)
+            { }
+            
+            //  V.  Accessors:
+            //  PURPOSE:  To return the number of chars written.  No parameters.
+            size_t		getNumChars
+            ()
+            const
+            throw()
+            { return(numChars_); }
+            
+        };
+        
+        
+        //  PURPOSE:  To report on 'std::cerr', after 'label', how fast 'grammar'
+        //	parses 'sentenceStr'.  If 'shouldTrace' is 'true' the trace is
+        //	formatted and written, but into a 'NullStreamBuf' rather than to
+        //	a file or terminal.  No return value.
+        void		reportParse
+        (const char*		label,
+         Grammar&		grammar,
+         const std::string&	sentenceStr,
+         bool			shouldTrace
+         )
+        throw(const char*)
         {
             //  I.  Application validity check:
             
-            //  II.  Create and return set:
-            //  II.A.  Create and initialize a datastructure that keeps track of the
-            //  	     NonTerminal instances that have not yet been visited:
-            std::map<Symbol*,bool>	haveVisitedMap;
+            //  II.  Time parse:
+            std::streambuf*	coutBufPtr	= std::cout.rdbuf();
+            NullStreamBuf	nullBuf;
+            uInt		numTokens	= 1;
+            
+            for  (uInt i = 0;  i < sentenceStr.length();  i++)
+                if  ( isspace(sentenceStr[i]) )
+                    numTokens++;
+            
+            if  (shouldTrace)
+                std::cout.rdbuf(&nullBuf);
+            
+            double	startTime	= nowInSeconds();
+            
+            try
+            {
+                grammar.parse(sentenceStr,shouldTrace);
+            }
+            catch  (const char*	errCPtr)
+            {
+                std::cout.rdbuf(coutBufPtr);
+                std::cout.clear();
+                throw;
+            }
+            
+            double	parseTime	= nowInSeconds() - startTime;
             
-            for  (uInt i = 0;  i < grammar.getNumSymbols();  i++)
-                haveVisitedMap[grammar.getSymbolPtr(i)] = false;
+            std::cout.rdbuf(coutBufPtr);
+            std::cout.clear();
             
-            //  II.B.  Create and return set:
-            return( internalFirst(symbolList,grammar,haveVisitedMap) );
+            //  III.  Finished:
+            std::cerr << label << " " << numTokens << " tokens in "
+            << parseTime * 1e3 << " ms ("
+            << numTokens / parseTime / 1e6 << " Mtokens/s";
+            
+            if  (shouldTrace)
+                std::cerr << ", " << nullBuf.getNumChars() / 1e6
+                << " MB of trace";
+            
+            std::cerr << ")\n";
         }
         
         
-        //  PURPOSE:  To return 'true' if all of the Symbol instances in 'str' can
-        //	derive the empty string, or 'false' otherwise.
-        bool		doAllDeriveEmpty
-        (std::vector<Symbol*>&	str
+        //  PURPOSE:  To report on 'std::cerr' the bytes the LL(1) table of
+        //	'grammar' (named 'name') takes, against the bytes of a dense table
+        //	of 'Production*' with a row for every Symbol, the time of a table
+        //	lookup, and the rate 'grammar' parses 'sentenceStr' at without
+        //	tracing.  No return value.
+        void		reportTable
+        (const char*		name,
+         Grammar&		grammar,
+         const std::string&	sentenceStr
          )
-        throw()
+        throw(const char*)
         {
             //  I.  Application validity check:
             
-            //  II.  See if all Symbol instances in 'str' can derive to empty string:
-            //  II.A.  Each iteration checks one Symbol instance:
-            for  (uInt i = 0;  i < str.size();  i++)
-                if  ( !str[i]->canDeriveEmpty() )
-                    return(false);
+            //  II.  Report:
+            //  II.A.  Report sizes:
+            uInt	numTerminals	= grammar.getNumTerminals();
+            uInt	numSymbols	= grammar.getNumSymbols();
+            size_t	denseNumBytes	= numSymbols * sizeof(Production**) +
+                                  (size_t)numSymbols * numTerminals * sizeof(Production*);
+            
+            std::cerr << name << ": " << numSymbols << " symbols, table "
+            << grammar.getTableNumBytes() << " bytes (dense "
+            << denseNumBytes << " bytes)\n";
+            
+            //  II.B.  Time lookups of every (NonTerminal,Terminal) pair:
+            const uInt	MIN_NUM_LOOKUPS	= 10000000;
+            uInt		numPairs	= (numSymbols - numTerminals) * numTerminals;
+            uInt		numPasses	= MIN_NUM_LOOKUPS / numPairs + 1;
+            size_t		numFound	= 0;
+            double		startTime	= nowInSeconds();
+            
+            for  (uInt pass = 0;  pass < numPasses;  pass++)
+                for  (uInt ni = numTerminals;  ni < numSymbols;  ni++)
+                    for  (uInt ti = 0;  ti < numTerminals;  ti++)
+                        numFound += (grammar.getTableProduction(ni,ti) != NULL);
+            
+            std::cerr << "  lookup "
+            << (nowInSeconds() - startTime) * 1e9 / ((double)numPasses * numPairs)
+            << " ns (" << numFound / numPasses << " entries)\n";
+            
+            //  II.C.  Time a parse:
+            reportParse("  parse",grammar,sentenceStr,false);
             
             //  III.  Finished:
-            return(true);
         }
         
         
-        std::set<Terminal*>
-        internalFollowTerminalSet
-        (NonTerminal*			nonTermPtr,
-         Grammar&			grammar,
-         std::map<Symbol*,bool>&	haveVisitedMap
+        //  PURPOSE:  To report on 'std::cerr' the size and speed of the LL(1)
+        //	table for the "AC" grammar (#6 below) and for a generated grammar
+        //	of 'numSymbols' symbols.  Returns 'EXIT_SUCCESS' on success or
+        //	'EXIT_FAILURE' otherwise.
+        int		benchmarkTable
+        (uInt	numSymbols
          )
-        throw()
         {
-            //  I.  Application validity check:
+            const uInt	NUM_AC_STATEMENTS	= 20000;
             
-            //  II.  :
-            std::set<Terminal*>	toReturn;
+            try
+            {
+                //  I.  Report on the "AC" grammar:
+                {
+                    std::string	sentenceStr	= "float id int id";
+                    Grammar		grammar(AC_GRAMMAR,false);
+                    
+                    for  (uInt i = 0;  i < NUM_AC_STATEMENTS;  i++)
+                        sentenceStr	+= " id = 5 id = id + 5.5 print id";
+                    
+                    reportTable("AC grammar",grammar,sentenceStr);
+                }
+                
+                //  II.  Report on a generated grammar, with a sentence that
+                //	 goes down its chain of NonTerminal instances until an
+                //	 odd-numbered one that derives empty:
+                {
+                    Grammar		grammar(generateGrammar(numSymbols),false);
+                    uInt		numTerminals	= numSymbols / 16;
+                    uInt		length		= (grammar.getNumSymbols() -
+                                                   grammar.getNumTerminals()
+                                                  ) / 2;
+                    std::string	sentenceStr;
+                    
+                    if  (numTerminals < 2)
+                        numTerminals	= 2;
+                    
+                    length	|= 1;
+                    
+                    for  (uInt i = 0;  i < length;  i++)
+                    {
+                        snprintf(text,TEXT_LEN,"%st%u",(i == 0) ? "" : " ",
+                                 i % numTerminals
+                                 );
+                        sentenceStr	+= text;
+                    }
+                    
+                    reportTable("generated grammar",grammar,sentenceStr);
+                }
+            }
+            catch  (const char*	errCPtr)
+            {
+                std::cerr << errCPtr << std::endl;
+                return(EXIT_FAILURE);
+            }
             
-            if  ( !haveVisitedMap[nonTermPtr] )
+            return(EXIT_SUCCESS);
+        }
+        
+        
+        //  PURPOSE:  To report on 'std::cerr' how fast long sentences are parsed,
+        //	with and without tracing: a "AC" program of 'numStatements'
+        //	statements, and parentheses nested 'numStatements' deep.  Returns
+        //	'EXIT_SUCCESS' on success or 'EXIT_FAILURE' otherwise.
+        int		benchmarkParse
+        (uInt	numStatements
+         )
+        {
+            try
             {
-                haveVisitedMap[nonTermPtr]	= true;
+                //  I.  Report on a "AC" program:
+                {
+                    std::string	sentenceStr	= "float id int id";
+                    Grammar		grammar(AC_GRAMMAR,false);
+                    
+                    for  (uInt i = 0;  i < numStatements;  i++)
+                        sentenceStr	+= " id = 5 id = id + 5.5 print id";
+                    
+                    std::cerr << "AC program:\n";
+                    reportParse("  untraced",grammar,sentenceStr,false);
+                    reportParse("  traced",grammar,sentenceStr,true);
+                }
                 
-                for  (uInt pi = 0;  pi < grammar.getNumProductions();  pi++)
+                //  II.  Report on nested parentheses:
                 {
-                    uInt		ri;
-                    const Production*	prodPtr = grammar.getProductionPtr(pi);
+                    std::string	sentenceStr;
+                    Grammar		grammar("{(,)},{P,S},P,{P - S, S - ( S ), S - }",false);
                     
-                    for  (ri = 0;  ri < prodPtr->getRhsLength();  ri++)
-                        if  (nonTermPtr == prodPtr->getRhsSymbol(ri))
-                            break;
+                    for  (uInt i = 0;  i < numStatements;  i++)
+                        sentenceStr	+= "( ";
                     
-                    if  (ri >= prodPtr->getRhsLength())
-                        continue;
+                    for  (uInt i = 0;  i < numStatements;  i++)
+                        sentenceStr	+= (i == 0) ? ")" : " )";
                     
-                    std::vector<Symbol*>	tail;
+                    std::cerr << "Nested parentheses:\n";
+                    reportParse("  untraced",grammar,sentenceStr,false);
+                }
+            }
+            catch  (const char*	errCPtr)
+            {
+                std::cerr << errCPtr << std::endl;
+                return(EXIT_FAILURE);
+            }
+            
+            return(EXIT_SUCCESS);
+        }
+        
+        
+        //  PURPOSE:  To report on 'std::cerr' how long it takes to build a
+        //	Grammar of 'numSymbols' generated symbols, against saving it and
+        //	loading it back, and to check that loading rejects a file built
+        //	from another description or damaged.  Returns 'EXIT_SUCCESS' on
+        //	success or 'EXIT_FAILURE' otherwise.
+        int		benchmarkLoad
+        (uInt	numSymbols
+         )
+        {
+            const int	NUM_REPETITIONS	= 5;
+            char	path[]		= "/tmp/llParserMakerXXXXXX";
+            int		fd		= mkstemp(path);
+            int		status		= EXIT_SUCCESS;
+            
+            if  (fd < 0)
+            {
+                std::cerr << "Cannot create a temporary file" << std::endl;
+                return(EXIT_FAILURE);
+            }
+            
+            close(fd);
+            
+            try
+            {
+                //  I.  Time building and saving:
+                std::string	descriptionStr	= generateGrammar(numSymbols);
+                double		startTime	= nowInSeconds();
+                Grammar		grammar(descriptionStr,false);
+                double		buildTime	= nowInSeconds() - startTime;
+                
+                startTime	= nowInSeconds();
+                grammar.save(path,descriptionStr);
+                
+                double		saveTime	= nowInSeconds() - startTime;
+                double		bestLoadTime	= 1e30;
+                
+                //  II.  Time loading, and parse with what was loaded:
+                for  (int rep = 0;  rep < NUM_REPETITIONS;  rep++)
+                {
+                    startTime	= nowInSeconds();
                     
-                    for  (uInt i = ri + 1;  i < prodPtr->getRhsLength();  i++)
-                        tail.push_back(prodPtr->getRhsSymbol(i));
+                    MappedFile	file(path);
+                    Grammar		loaded(file,descriptionStr);
+                    double		loadTime	= nowInSeconds() - startTime;
                     
-                    unionSecondIntoFirst(toReturn,first(tail,grammar));
+                    if  (loadTime < bestLoadTime)
+                        bestLoadTime	= loadTime;
                     
-                    if  ( doAllDeriveEmpty(tail) )
+                    if  (rep == 0)
                     {
-                        const NonTerminal* lhs	= prodPtr->getLhsPtr();
-                        
-                        unionSecondIntoFirst
-                        (toReturn,
-                         internalFollowTerminalSet
-                         (prodPtr->getLhsPtr(),
-                          grammar,
-                          haveVisitedMap
-                          )
-                         );
+                        loaded.parse("t0");
+                        std::cerr << grammar.getNumSymbols() << " symbols, "
+                        << file.getLength() << " bytes: build "
+                        << buildTime * 1e3 << " ms, save " << saveTime * 1e3
+                        << " ms, ";
                     }
+                }
+                
+                std::cerr << "load " << bestLoadTime * 1e3 << " ms\n";
+                
+                //  III.  Check that stale and damaged files are rejected:
+                bool	wasRejected	= false;
+                
+                try
+                {
+                    MappedFile	file(path);
+                    Grammar		loaded(file,descriptionStr + " ");
+                }
+                catch  (const char*	errCPtr)
+                {
+                    std::cerr << "Other description: " << errCPtr << "\n";
+                    wasRejected	= true;
+                }
+                
+                std::string	bytes;
+                
+                {
+                    MappedFile	file(path);
+                    
+                    bytes.assign(file.getBytes(),file.getLength());
+                }
+                
+                bytes[bytes.length() / 2]	^= 1;
+                
+                FILE*	filePtr	= fopen(path,"wb");
+                
+                if  (filePtr != NULL)
+                {
+                    fwrite(bytes.data(),1,bytes.length(),filePtr);
+                    fclose(filePtr);
+                }
+                
+                try
+                {
+                    MappedFile	file(path);
+                    Grammar		loaded(file,descriptionStr);
                     
+                    wasRejected	= false;
+                }
+                catch  (const char*	errCPtr)
+                {
+                    std::cerr << "Damaged file: " << errCPtr << "\n";
                 }
                 
+                if  (!wasRejected)
+                {
+                    std::cerr << "A stale or damaged file was loaded" << std::endl;
+                    status	= EXIT_FAILURE;
+                }
+            }
+            catch  (const char*	errCPtr)
+            {
+                std::cerr << errCPtr << std::endl;
+                status	= EXIT_FAILURE;
             }
             
-            //  III.  Finished:
-            return(toReturn);
+            unlink(path);
+            return(status);
         }
         
         
-        //  PURPOSE:  To create and return the set of NonTerminal instances that can
-        //	follow '*nonTermPtr' in 'grammar'.
-        std::set<Terminal*>
-        createFollowTerminalSet
-        (NonTerminal*		nonTermPtr,
-         Grammar&		grammar
+        //  PURPOSE:  To report on 'std::cerr', after 'label', how fast 'grammar'
+        //	turns 'toScanStr' into tokens (the best of several times).  No
+        //	return value.
+        void		reportTokens
+        (const char*		label,
+         Grammar&		grammar,
+         const std::string&	toScanStr
          )
-        throw()
+        throw(const char*)
         {
-            //  I.  Application validity check:
+            const int	NUM_REPETITIONS	= 5;
+            double	bestTime	= 1e30;
+            uInt	numTokens	= 0;
             
-            //  II.  Create and initialize a datastructure that keeps track of the
-            //  	   NonTerminal instances that have not yet been visited:
-            std::map<Symbol*,bool>	haveVisitedMap;
-            
-            for  (uInt i = 0;  i < grammar.getNumSymbols();  i++)
-                haveVisitedMap[grammar.getSymbolPtr(i)] = false;
+            for  (int rep = 0;  rep < NUM_REPETITIONS;  rep++)
+            {
+                double	startTime	= nowInSeconds();
+                
+                numTokens	= grammar.countTokens(toScanStr);
+                
+                double	time		= nowInSeconds() - startTime;
+                
+                if  (time < bestTime)
+                    bestTime	= time;
+            }
             
-            //  III.  Finished:
-            return( internalFollowTerminalSet(nonTermPtr,grammar,haveVisitedMap) );
+            std::cerr << label << " " << numTokens << " tokens, "
+            << toScanStr.length() << " chars: "
+            << toScanStr.length() / bestTime / 1e6 << " MB/s, "
+            << numTokens / bestTime / 1e6 << " Mtokens/s\n";
         }
         
         
-        //  PURPOSE:  To create and return a std::set<> of Terminal instances that
-        //	may begin expansions of '*this' Production in Grammar 'grammar'.
-        std::set<Terminal*>
-        Production::createPredictedTerminalSet
-        (Grammar&	grammar
+        //  PURPOSE:  To report on 'std::cerr' how fast text is turned into
+        //	tokens: "AC" programs of 'numStatements' statements with and
+        //	without spaces between tokens, and a sentence as long of the
+        //	Terminal instances of a generated grammar of 10000 symbols.
+        //	Returns 'EXIT_SUCCESS' on success or 'EXIT_FAILURE' otherwise.
+        int		benchmarkTokens
+        (uInt	numStatements
          )
-        const
-        throw()
         {
-            //  I.  Application validity check:
-            
-            //  II.  Compute set of Terminal instances:
-            //  II.A.  Obtain the Terminal instances that can be at the beginning of
-            //	     'rhs_'.
-            std::set<Terminal*>	toReturn= first(getRhs(),grammar);
+            const uInt	NUM_GENERATED_SYMBOLS	= 10000;
             
-            //  II.B.  If 'rhs_' can derive the empty string, then also include the
-            //  	     Terminal instances that can follow the LHS in other productions:
-            if  ( canDeriveEmpty() )
+            try
             {
-                std::set<Terminal*>	temp	= createFollowTerminalSet(getLhsPtr(),grammar);
+                //  I.  Report on "AC" programs:
+                {
+                    Grammar		grammar(AC_GRAMMAR,false);
+                    std::string	spacedStr	= "float id int id";
+                    std::string	unspacedStr	= "floatid intid";
+                    
+                    for  (uInt i = 0;  i < numStatements;  i++)
+                    {
+                        spacedStr	+= " id = 5 id = id + 5.5 print id";
+                        unspacedStr	+= " id=5 id=id+5.5 printid";
+                    }
+                    
+                    reportTokens("AC, spaced:  ",grammar,spacedStr);
+                    reportTokens("AC, unspaced:",grammar,unspacedStr);
+                }
                 
-                unionSecondIntoFirst(toReturn,temp);
+                //  II.  Report on a generated grammar:
+                {
+                    Grammar		grammar(generateGrammar(NUM_GENERATED_SYMBOLS),
+                                        false
+                                        );
+                    uInt		numTerminals	= NUM_GENERATED_SYMBOLS / 16;
+                    std::string	sentenceStr;
+                    
+                    for  (uInt i = 0;  i < 7 * numStatements;  i++)
+                    {
+                        snprintf(text,TEXT_LEN," t%u",(i * 7919) % numTerminals);
+                        sentenceStr	+= text;
+                    }
+                    
+                    reportTokens("generated:   ",grammar,sentenceStr);
+                }
+            }
+            catch  (const char*	errCPtr)
+            {
+                std::cerr << errCPtr << std::endl;
+                return(EXIT_FAILURE);
             }
             
-            //  III.  Finished:
-            std::cout << "The predicted term set of " << toString()
-            << " is:" << std::endl;
-            printSet(toReturn);
-            
-            return(toReturn);
+            return(EXIT_SUCCESS);
         }
         
         
         //  PURPOSE:  To ask the user for the definition of a grammar, and then a
         //	sentence to parse.  Then attempts to parse the sentence according to
-        //	the LL(1) rules for the parser.  Ignores command line parameters.
-        int		main	()
+        //	the LL(1) rules for the parser, printing each step of the parse if
+        //	"--trace" is given.  Ignores other command line parameters,
+        //	except that "--bench-symbols N" instead times the symbol table and
+        //	Grammar construction on a generated grammar of N symbols, and
+        //	"--bench-table N" reports the size and speed of the LL(1) table for
+        //	the "AC" grammar and a generated grammar of N symbols, and
+        //	"--bench-parse N" reports the token rate of parsing sentences of N
+        //	statements or nestings.  "--emit-header NAME" instead reads just
+        //	the grammar and writes a C++ header with its parser, in namespace
+        //	NAME, to 'std::cout'.  "--cache FILE" loads the built grammar from
+        //	FILE if it was saved there for the same grammar string, or else
+        //	builds it and saves it there, and "--bench-load N" times that for
+        //	a generated grammar of N symbols.  "--bench-tokens N" reports how
+        //	fast "AC" programs of N statements are turned into tokens.
+        int		main	(int	argc,
+                         char*	argv[]
+                         )
         {
             //  I.  Application validity check:
+            if  ( (argc == 3)  &&  (strcmp(argv[1],"--bench-symbols") == 0) )
+                return(benchmarkSymbols(strtoul(argv[2],NULL,10)));
+            
+            if  ( (argc == 3)  &&  (strcmp(argv[1],"--bench-table") == 0) )
+                return(benchmarkTable(strtoul(argv[2],NULL,10)));
+            
+            if  ( (argc == 3)  &&  (strcmp(argv[1],"--bench-parse") == 0) )
+                return(benchmarkParse(strtoul(argv[2],NULL,10)));
+            
+            if  ( (argc == 3)  &&  (strcmp(argv[1],"--bench-load") == 0) )
+                return(benchmarkLoad(strtoul(argv[2],NULL,10)));
+            
+            if  ( (argc == 3)  &&  (strcmp(argv[1],"--bench-tokens") == 0) )
+                return(benchmarkTokens(strtoul(argv[2],NULL,10)));
+            
+            if  ( (argc == 3)  &&  (strcmp(argv[1],"--emit-header") == 0) )
+            {
+                std::string	grammarStr;
+                
+                std::getline(std::cin,grammarStr);
+                
+                try
+                {
+                    Grammar	grammar(grammarStr,false);
+                    
+                    grammar.writeHeader(std::cout,argv[2],grammarStr);
+                }
+                catch  (const char*	errCPtr)
+                {
+                    std::cerr << errCPtr << std::endl;
+                    return(EXIT_FAILURE);
+                }
+                
+                return(EXIT_SUCCESS);
+            }
+            
+            const char*		cachePathPtr	= NULL;
+            bool		shouldTrace	= false;
+            
+            for  (int argInd = 1;  argInd < argc;  argInd++)
+                if  (strcmp(argv[argInd],"--trace") == 0)
+                    shouldTrace	= true;
+                else
+                if  ( (strcmp(argv[argInd],"--cache") == 0)  &&  (argInd+1 < argc) )
+                    cachePathPtr	= argv[++argInd];
             
             //  II.  Do program:
             //  II.A.  Get grammar:
             std::string		grammarStr;
             int			status	= EXIT_SUCCESS;
+            Grammar*		grammarPtr	= NULL;
             
             std::cout
             << "Please enter the grammar string like:\n"
@@ -2802,12 +4703,38 @@ class		Grammar
             try
             {
                 std::string	sentenceStr;
-                Grammar	grammar(grammarStr);
                 
+                //  II.B.  Load grammar from cache, or build it:
+                if  (cachePathPtr != NULL)
+                {
+                    try
+                    {
+                        MappedFile	file(cachePathPtr);
+                        
+                        grammarPtr	= new Grammar(file,grammarStr);
+                    }
+                    catch  (const char*	errCPtr)
+                    {
+                        std::cerr << errCPtr << ", rebuilding." << std::endl;
+                    }
+                }
+                
+                if  (grammarPtr == NULL)
+                {
+                    grammarPtr	= new Grammar(grammarStr);
+                    
+                    if  (cachePathPtr != NULL)
+                        grammarPtr->save(cachePathPtr,grammarStr);
+                }
+                
+                //  II.C.  Parse sentence:
                 std::cout << "Please enter text to parse: ";
                 std::getline(std::cin,sentenceStr);
                 
-                grammar.parse(sentenceStr);
+                grammarPtr->parse(sentenceStr,shouldTrace);
+                
+                if  (!shouldTrace)
+                    std::cout << "Parse completed." << std::endl;
             }
             catch  (const char*	errCPtr)
             {
@@ -2816,6 +4743,7 @@ class		Grammar
             }
             
             //  III.  Finished:
+            delete(grammarPtr);
             return(status);
         }
         